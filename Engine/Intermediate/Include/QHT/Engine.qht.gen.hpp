@@ -5,6 +5,7 @@
 #include <string>
 #include <unordered_map>
 #include <stdexcept>
+#include <utility>
 #include "qmeta_runtime.h"
 using namespace qmeta;
 // Unit: Engine
@@ -22,12 +23,20 @@ static Variant _qmeta_invoke_QActor_SetActorInteger(void* Self, const Variant* a
     return Variant();
 }
 
+static void _qmeta_typed_QActor_SetActorInteger(void* Self, int _p0) {
+    return static_cast<QActor*>(Self)->SetActorInteger(std::forward<int>(_p0));
+}
+
 static Variant _qmeta_invoke_QActor_GetOwner(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QActor*>(Self);
     auto _ret = self->GetOwner();
     return Variant(_ret);
 }
 
+static QObject* _qmeta_typed_QActor_GetOwner(void* Self) {
+    return static_cast<QActor*>(Self)->GetOwner();
+}
+
 static Variant _qmeta_invoke_QActor_SetOwner(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QActor*>(Self);
     if (argc < 1) throw std::runtime_error("QActor::SetOwner requires 1 args");
@@ -36,6 +45,10 @@ static Variant _qmeta_invoke_QActor_SetOwner(void* Self, const Variant* args, si
     return Variant();
 }
 
+static void _qmeta_typed_QActor_SetOwner(void* Self, QObject* _p0) {
+    return static_cast<QActor*>(Self)->SetOwner(std::forward<QObject*>(_p0));
+}
+
 static Variant _qmeta_invoke_QWorld_AddObject(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QWorld*>(Self);
     if (argc < 1) throw std::runtime_error("QWorld::AddObject requires 1 args");
@@ -44,6 +57,10 @@ static Variant _qmeta_invoke_QWorld_AddObject(void* Self, const Variant* args, s
     return Variant();
 }
 
+static void _qmeta_typed_QWorld_AddObject(void* Self, const std::string& _p0) {
+    return static_cast<QWorld*>(Self)->AddObject(std::forward<const std::string&>(_p0));
+}
+
 static Variant _qmeta_invoke_QWorld_RemoveObject(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QWorld*>(Self);
     if (argc < 1) throw std::runtime_error("QWorld::RemoveObject requires 1 args");
@@ -52,17 +69,23 @@ static Variant _qmeta_invoke_QWorld_RemoveObject(void* Self, const Variant* args
     return Variant();
 }
 
+static void _qmeta_typed_QWorld_RemoveObject(void* Self, const std::string& _p0) {
+    return static_cast<QWorld*>(Self)->RemoveObject(std::forward<const std::string&>(_p0));
+}
+
 inline void QHT_Register_Engine(Registry& R) {
     TypeInfo& T_QActor = R.add_type("QActor", sizeof(QActor));
     T_QActor.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Engine")) };
+    T_QActor.relocate = qmeta::GetRelocateFn<QActor>();
     T_QActor.base_name = "QObject";
-    T_QActor.properties.push_back(MetaProperty{"ActorInteger", "int", offsetof(QActor, ActorInteger), MetaMap{}, PF_None });
-    T_QActor.properties.push_back(MetaProperty{"Owner", "QObject*", offsetof(QActor, Owner), MetaMap{}, PF_RawQObjectPtr });
+    T_QActor.properties.push_back(MetaProperty{"ActorInteger", "int", offsetof(QActor, ActorInteger), MetaMap{}, PF_None, EPropertyType::Int32, sizeof(int), alignof(int) });
+    T_QActor.properties.push_back(MetaProperty{"Owner", "QObject*", offsetof(QActor, Owner), MetaMap{}, PF_RawQObjectPtr, EPropertyType::ObjectRef, sizeof(QObject*), alignof(QObject*) });
     {
         MetaFunction F;
         F.name = "SetActorInteger";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QActor_SetActorInteger;
+        F.SetTypedInvoker(&_qmeta_typed_QActor_SetActorInteger);
         F.params = std::vector<MetaParam>{ MetaParam{"InValue", "int"} };
         F.meta = MetaMap{};
         T_QActor.functions.push_back(std::move(F));
@@ -72,6 +95,7 @@ inline void QHT_Register_Engine(Registry& R) {
         F.name = "GetOwner";
         F.return_type = "QObject*";
         F.invoker = &_qmeta_invoke_QActor_GetOwner;
+        F.SetTypedInvoker(&_qmeta_typed_QActor_GetOwner);
         F.params = std::vector<MetaParam>{  };
         F.meta = MetaMap{};
         T_QActor.functions.push_back(std::move(F));
@@ -81,27 +105,32 @@ inline void QHT_Register_Engine(Registry& R) {
         F.name = "SetOwner";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QActor_SetOwner;
+        F.SetTypedInvoker(&_qmeta_typed_QActor_SetOwner);
         F.params = std::vector<MetaParam>{ MetaParam{"InOwner", "QObject*"} };
         F.meta = MetaMap{};
         T_QActor.functions.push_back(std::move(F));
     }
     TypeInfo& T_QCharacter = R.add_type("QCharacter", sizeof(QCharacter));
     T_QCharacter.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Engine")) };
+    T_QCharacter.relocate = qmeta::GetRelocateFn<QCharacter>();
     T_QCharacter.base_name = "QActor";
-    T_QCharacter.properties.push_back(MetaProperty{"Health", "int", offsetof(QCharacter, Health), MetaMap{}, PF_None });
-    T_QCharacter.properties.push_back(MetaProperty{"TestValue", "float", offsetof(QCharacter, TestValue), MetaMap{}, PF_None });
+    T_QCharacter.properties.push_back(MetaProperty{"Health", "int", offsetof(QCharacter, Health), MetaMap{}, PF_None, EPropertyType::Int32, sizeof(int), alignof(int) });
+    T_QCharacter.properties.push_back(MetaProperty{"TestValue", "float", offsetof(QCharacter, TestValue), MetaMap{}, PF_None, EPropertyType::Float, sizeof(float), alignof(float) });
     TypeInfo& T_QObject = R.add_type("QObject", sizeof(QObject));
     T_QObject.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Engine")) };
+    T_QObject.relocate = qmeta::GetRelocateFn<QObject>();
     T_QObject.base_name = "QObjectBase";
     TypeInfo& T_QWorld = R.add_type("QWorld", sizeof(QWorld));
     T_QWorld.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Engine")) };
+    T_QWorld.relocate = qmeta::GetRelocateFn<QWorld>();
     T_QWorld.base_name = "QObject";
-    T_QWorld.properties.push_back(MetaProperty{"Objects", "std::vector<QObject*>", offsetof(QWorld, Objects), MetaMap{}, PF_VectorOfQObjectPtr });
+    T_QWorld.properties.push_back(MetaProperty{"Objects", "std::vector<QObject*>", offsetof(QWorld, Objects), MetaMap{}, PF_VectorOfQObjectPtr, EPropertyType::ObjectRefArray, sizeof(QObject*), alignof(QObject*) });
     {
         MetaFunction F;
         F.name = "AddObject";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QWorld_AddObject;
+        F.SetTypedInvoker(&_qmeta_typed_QWorld_AddObject);
         F.params = std::vector<MetaParam>{ MetaParam{"ObjName", "const std::string&"} };
         F.meta = MetaMap{};
         T_QWorld.functions.push_back(std::move(F));
@@ -111,6 +140,7 @@ inline void QHT_Register_Engine(Registry& R) {
         F.name = "RemoveObject";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QWorld_RemoveObject;
+        F.SetTypedInvoker(&_qmeta_typed_QWorld_RemoveObject);
         F.params = std::vector<MetaParam>{ MetaParam{"ObjName", "const std::string&"} };
         F.meta = MetaMap{};
         T_QWorld.functions.push_back(std::move(F));
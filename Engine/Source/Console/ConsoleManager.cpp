@@ -5,6 +5,7 @@
 #include "ConsoleUtil.h"
 #include "EngineUtils.h"
 #include "GarbageCollector.h"
+#include "GcSafepoint.h"
 #include "Runtime.h"
 #include "CoreObjects/Public/World.h"
 
@@ -38,15 +39,25 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
         if (Cmd == "help")
         {
             std::cout <<
-                "Commands:\n"
+                "Commands: (objects are given by debug name or #Id)\n"
                 "  new <Type> <Name>\n"
-                "  link <OwnerName> <Property> <TargetName>\n"
-                "  unlink <OwnerName> <Property>\n"
-                "  set <Name> <Property> <Value>\n"
-                "  call <Name> <Function> [args...]\n"
-                "  save <Name> [FileName]\n"
-                "  load <Type> <Name> [FileName]\n"
+                "  link <Owner> <Property> <Target>\n"
+                "  unlink [single|all] <Owner> [Property]\n"
+                "  set <Object> <Property> <Value>\n"
+                "  setall <Type> <Property> <Value>\n"
+                "  sum|min|max <Type> <Property>\n"
+                "  call <Object> <Function> [args...]\n"
+                "  save <Object> [FileName]\n"
+                "  load <Object> [FileName]\n"
                 "  gc\n"
+                "  gc cluster <Name> | gc uncluster <Name|all> | gc autocluster <N>\n"
+                "  gc root <Name>\n"
+                "  gc pool <stats|cap <N>|trim [keep]>\n"
+                "  gc compact [on|off]\n"
+                "  gc mode [stw|fork]\n"
+                "  gc stackscan [on|off]\n"
+                "  gc pending | gc flush\n"
+                "  gc mutators\n"
                 "  tick <seconds>\n"
                 "  ls\n"
                 "  props <Name>\n"
@@ -66,6 +77,77 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
                 GC.Collect();
                 return true;    
             }
+            else if (Tokens.size() == 2 && Tokens[1] == "mutators")
+            {
+                GcListMutators();
+                return true;
+            }
+            else if (Tokens.size() == 2 && Tokens[1] == "pending")
+            {
+                std::cout << "[gc] pending kill: " << GC.GetNumPendingKill() << " objects\n";
+                return true;
+            }
+            else if (Tokens.size() == 2 && Tokens[1] == "flush")
+            {
+                const size_t NumFinished = GC.ProcessPendingKill(true);
+                std::cout << "[gc] finished " << NumFinished << " pending-kill objects\n";
+                return true;
+            }
+            else if (Tokens.size() == 2 && Tokens[1] == "compact")
+            {
+                GC.Compact();
+                return true;
+            }
+            else if (Tokens.size() == 3 && Tokens[1] == "compact")
+            {
+                if (Tokens[2] != "on" && Tokens[2] != "off")
+                {
+                    std::cout << "Usage: gc compact [on|off]\n";
+                    return true;
+                }
+                GC.SetCompactAfterCollect(Tokens[2] == "on");
+                std::cout << "[gc] compact after collect: " << Tokens[2] << "\n";
+                return true;
+            }
+            else if (Tokens.size() == 3 && Tokens[1] == "stackscan")
+            {
+                if (Tokens[2] != "on" && Tokens[2] != "off")
+                {
+                    std::cout << "Usage: gc stackscan [on|off]\n";
+                    return true;
+                }
+                if (!GC.SetConservativeStackScan(Tokens[2] == "on"))
+                {
+                    std::cout << "[gc] conservative stack scan is only supported on Linux\n";
+                    return true;
+                }
+                std::cout << "[gc] conservative stack scan: " << Tokens[2] << "\n";
+                return true;
+            }
+            else if (Tokens.size() == 2 && Tokens[1] == "mode")
+            {
+                const bool bFork = GC.GetMode() == GarbageCollector::EGcMode::Fork;
+                std::cout << "[gc] mode: " << (bFork ? "fork" : "stw")
+                          << (GC.IsForkCollectPending() ? " (fork collection pending)" : "") << "\n";
+                return true;
+            }
+            else if (Tokens.size() == 3 && Tokens[1] == "mode")
+            {
+                if (Tokens[2] != "stw" && Tokens[2] != "fork")
+                {
+                    std::cout << "Usage: gc mode [stw|fork]\n";
+                    return true;
+                }
+                
+                const auto NewMode = Tokens[2] == "fork" ? GarbageCollector::EGcMode::Fork : GarbageCollector::EGcMode::StopTheWorld;
+                if (!GC.SetMode(NewMode))
+                {
+                    std::cout << "[gc] fork mode is only supported on Linux\n";
+                    return true;
+                }
+                std::cout << "[gc] mode: " << Tokens[2] << "\n";
+                return true;
+            }
             else if (Tokens.size() == 2)
             {
                 if (Tokens[1] == "t")
@@ -83,6 +165,96 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
                     std::cout << "Usage: gc <t|f>\n";
                 }
             }
+            else if (Tokens.size() >= 3 && Tokens[1] == "pool")
+            {
+                const std::string PoolUsage = "Usage: gc pool <stats|cap <N>|trim [keep]>\n";
+                long long n = 0;
+                if (Tokens[2] == "stats")
+                {
+                    GC.ListPools();
+                }
+                else if (Tokens[2] == "cap" && Tokens.size() == 4 && TryParseInt(Tokens[3], n) && n >= 0)
+                {
+                    GC.SetPoolCap(static_cast<size_t>(n));
+                    std::cout << "[gc] pool cap = " << n << " blocks per type\n";
+                }
+                else if (Tokens[2] == "trim")
+                {
+                    if (Tokens.size() == 4 && (!TryParseInt(Tokens[3], n) || n < 0))
+                    {
+                        std::cout << PoolUsage;
+                        return true;
+                    }
+                    const size_t Bytes = GC.TrimPools(static_cast<size_t>(n));
+                    std::cout << "[gc] pool trimmed, " << Bytes << " bytes unmapped\n";
+                }
+                else
+                {
+                    std::cout << PoolUsage;
+                }
+                return true;
+            }
+            else if (Tokens.size() == 3 && Tokens[1] == "cluster")
+            {
+                QObject* Obj = GC.FindByDebugName(Tokens[2]);
+                if (!Obj)
+                {
+                    std::cout << "Not found: " << Tokens[2] << "\n";
+                    return true;
+                }
+                
+                const size_t Members = GC.CreateCluster(Obj);
+                if (Members == 0)
+                {
+                    std::cout << "[gc] cluster not created (already clustered, ignored, or no members)\n";
+                }
+                else
+                {
+                    std::cout << "[gc] cluster " << Tokens[2] << " members=" << Members << "\n";
+                }
+                return true;
+            }
+            else if (Tokens.size() == 3 && Tokens[1] == "uncluster")
+            {
+                if (Tokens[2] == "all")
+                {
+                    GC.DissolveAllClusters();
+                    std::cout << "[gc] all clusters dissolved\n";
+                    return true;
+                }
+                
+                QObject* Obj = GC.FindByDebugName(Tokens[2]);
+                if (!Obj || !GC.DissolveCluster(Obj))
+                {
+                    std::cout << "[gc] " << Tokens[2] << " is not in a cluster\n";
+                    return true;
+                }
+                std::cout << "[gc] cluster dissolved: " << Tokens[2] << "\n";
+                return true;
+            }
+            else if (Tokens.size() == 3 && Tokens[1] == "root")
+            {
+                QObject* Obj = GC.FindByNameOrId(Tokens[2]);
+                if (!Obj)
+                {
+                    std::cout << "Not found: " << Tokens[2] << "\n";
+                    return true;
+                }
+                GC.CollectRegion(Obj);
+                return true;
+            }
+            else if (Tokens.size() == 3 && Tokens[1] == "autocluster")
+            {
+                long long n = 0;
+                if (!TryParseInt(Tokens[2], n) || n < 0)
+                {
+                    std::cout << "Usage: gc autocluster <N> (0 disables)\n";
+                    return true;
+                }
+                GC.SetAutoClusterAfter(static_cast<uint32_t>(n));
+                std::cout << "[gc] autocluster after " << n << " collections\n";
+                return true;
+            }
             else if (Tokens.size() == 3 && Tokens[1] == "threads")
             {
                 if (Tokens[2] == "auto")
@@ -159,12 +331,14 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
 
             auto FindTestManager = [&]() -> QObject* {
                 
-                const qmeta::TypeInfo* Ti = nullptr;
+                // Game type: resolved by name once, then matched with the O(1) IsA
+                static const qmeta::TypeInfo* const TestManagerTi = qmeta::GetRegistry().find("QGcTestManager");
+                if (!TestManagerTi) return nullptr;
                 for (QObject* Obj : W->Objects)
                 {
                     if (!Obj) continue;
-                    Ti = GC.GetTypeInfo(Obj);
-                    if (Ti && Ti->name == "QGcTestManager")
+                    const qmeta::TypeInfo* Ti = GC.GetTypeInfo(Obj);
+                    if (Ti && Ti->IsA(*TestManagerTi))
                     {
                         return Obj;
                     }
@@ -328,7 +502,7 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
                 // gctest pattern <chain|grid|random|rings|diamond> ...
                 if (Tokens.size() < 3)
                 {
-                    std::cout << "Usage: gctest pattern <chain|grid|random|rings|diamond> <args...>\n";
+                    std::cout << "Usage: gctest pattern <chain|grid|random|prandom|rings|diamond> <args...>\n";
                     return true;
                 }
                 const std::string Mode = Tokens[2];
@@ -372,6 +546,15 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
                     }
                     return true;
                 }
+                else if (Mode == "prandom")
+                {
+                    if (Tokens.size() < 5) { std::cout << "gctest pattern prandom <nodes> <branchCount> [seed]\n"; return true; }
+                    int Nodes = std::stoi(Tokens[3]);
+                    int BranchCount = std::stoi(Tokens[4]);
+                    int Seed = (Tokens.size() >= 6) ? std::stoi(Tokens[5]) : 1337;
+                    GC.Call(TestManager, "PatternRandomParallel", { qmeta::Variant(Nodes), qmeta::Variant(BranchCount), qmeta::Variant(Seed) });
+                    return true;
+                }
                 else if (Mode == "rings")
                 {
                     if (Tokens.size() < 5) { std::cout << "gctest pattern rings <rings> <ringSize> [seed]\n"; return true; }
@@ -471,6 +654,97 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
                 }
                 return true;
             }
+            else if (Tokens.size() >= 2 && Tokens[1] == "cluster")
+            {
+                // gctest cluster <nodesPerTester> <avgOut> [repeats]
+                if (Tokens.size() < 4) { std::cout << "gctest cluster <nodesPerTester> <avgOut> [repeats]\n"; return true; }
+                int Nodes = std::stoi(Tokens[2]);
+                int AvgOut = std::stoi(Tokens[3]);
+                int Repeats = (Tokens.size() >= 5) ? std::stoi(Tokens[4]) : 5;
+                GC.Call(TestManager, "BenchmarkClusters", { qmeta::Variant(Nodes), qmeta::Variant(AvgOut), qmeta::Variant(Repeats) });
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "mutators")
+            {
+                // gctest mutators <threads> <iterations> <nodes>
+                if (Tokens.size() < 5) { std::cout << "gctest mutators <threads> <iterations> <nodes>\n"; return true; }
+                int Threads = std::stoi(Tokens[2]);
+                int Iterations = std::stoi(Tokens[3]);
+                int Nodes = std::stoi(Tokens[4]);
+                GC.Call(TestManager, "StressMutators", { qmeta::Variant(Threads), qmeta::Variant(Iterations), qmeta::Variant(Nodes) });
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "teardown")
+            {
+                // gctest teardown <count> <megabytes>
+                if (Tokens.size() < 4) { std::cout << "gctest teardown <count> <megabytes>\n"; return true; }
+                int Count = std::stoi(Tokens[2]);
+                int Megabytes = std::stoi(Tokens[3]);
+                GC.Call(TestManager, "BenchmarkTeardown", { qmeta::Variant(Count), qmeta::Variant(Megabytes) });
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "region")
+            {
+                // gctest region <nodesPerTester> <avgOut> <breakCount>
+                if (Tokens.size() < 5) { std::cout << "gctest region <nodesPerTester> <avgOut> <breakCount>\n"; return true; }
+                int Nodes = std::stoi(Tokens[2]);
+                int AvgOut = std::stoi(Tokens[3]);
+                int BreakCount = std::stoi(Tokens[4]);
+                GC.Call(TestManager, "BenchmarkRegion", { qmeta::Variant(Nodes), qmeta::Variant(AvgOut), qmeta::Variant(BreakCount) });
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "fork")
+            {
+                // gctest fork <nodesPerTester> <avgOut> <breakCount>
+                if (Tokens.size() < 5) { std::cout << "gctest fork <nodesPerTester> <avgOut> <breakCount>\n"; return true; }
+                int Nodes = std::stoi(Tokens[2]);
+                int AvgOut = std::stoi(Tokens[3]);
+                int BreakCount = std::stoi(Tokens[4]);
+                GC.Call(TestManager, "BenchmarkForkMark", { qmeta::Variant(Nodes), qmeta::Variant(AvgOut), qmeta::Variant(BreakCount) });
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "stackscan")
+            {
+                // gctest stackscan <count>
+                if (Tokens.size() < 3) { std::cout << "gctest stackscan <count>\n"; return true; }
+                int Count = std::stoi(Tokens[2]);
+                GC.Call(TestManager, "CheckStackScan", { qmeta::Variant(Count) });
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "clusterlink")
+            {
+                // gctest clusterlink
+                GC.Call(TestManager, "CheckClusterLink", std::vector<qmeta::Variant>{});
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "permanent")
+            {
+                // gctest permanent
+                GC.Call(TestManager, "CheckMakePermanent", std::vector<qmeta::Variant>{});
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "names")
+            {
+                // gctest names
+                GC.Call(TestManager, "CheckNameTable", std::vector<qmeta::Variant>{});
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "transient")
+            {
+                // gctest transient <count>
+                if (Tokens.size() < 3) { std::cout << "gctest transient <count>\n"; return true; }
+                int Count = std::stoi(Tokens[2]);
+                GC.Call(TestManager, "BenchmarkTransient", { qmeta::Variant(Count) });
+                return true;
+            }
+            else if (Tokens.size() >= 2 && Tokens[1] == "calls")
+            {
+                // gctest calls <count>
+                if (Tokens.size() < 3) { std::cout << "gctest calls <count>\n"; return true; }
+                int Count = std::stoi(Tokens[2]);
+                GC.Call(TestManager, "BenchmarkCalls", { qmeta::Variant(Count) });
+                return true;
+            }
             else if (Tokens.size() >= 2 && Tokens[1] == "churn")
             {
                 // gctest churn <steps> <allocPerStep> <breakPct> <gcEveryN> [seed]
@@ -514,7 +788,7 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
             const std::string& ObjName = Tokens[1];
             const std::string& PropName = Tokens[2];
 
-            QObject* Obj = GC.FindByDebugName(ObjName);
+            QObject* Obj = GC.FindByNameOrId(ObjName);
             if (!Obj)
             {
                 std::cout << "Not found: " << ObjName << "\n";
@@ -549,7 +823,7 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
         else if (Cmd == "info" && Tokens.size() >= 2)
         {
             const std::string& ObjName = Tokens[1];
-            QObject* Obj = GC.FindByDebugName(ObjName);
+            QObject* Obj = GC.FindByNameOrId(ObjName);
             if (!Obj)
             {
                 std::cout << "[Info] Not found: " << ObjName << std::endl;
@@ -639,7 +913,7 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
             
             if (Tokens[1] == "single" && Tokens.size() == 4)
             {
-                bool bResult = GC.UnlinkByName(Tokens[2], Tokens[3]);
+                bool bResult = GC.Unlink(GC.FindByNameOrId(Tokens[2]), Tokens[3]);
                 if (!bResult)
                 {
                     std::cout << "Failed to unlink " << Tokens[1] << "." << Tokens[2] << "\n";
@@ -649,7 +923,7 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
             }
             else if (Tokens[1] == "all" && Tokens.size() == 3)
             {
-                bool bResult = GC.UnlinkAllByName(Tokens[2]);
+                bool bResult = GC.UnlinkAll(GC.FindByNameOrId(Tokens[2]));
                 if (!bResult)
                 {
                     std::cout << "Failed to unlink " << Tokens[1] << "." << Tokens[2] << "\n";
@@ -663,9 +937,37 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
                 return true;
             }
         }
+        else if (Cmd == "link")
+        {
+            if (Tokens.size() != 4)
+            {
+                std::cout << "Usage: link <Owner> <Property> <Target|null>\n";
+                return true;
+            }
+
+            const bool bNull = (Tokens[3] == "null");
+            QObject* Owner = GC.FindByNameOrId(Tokens[1]);
+            QObject* Target = bNull ? nullptr : GC.FindByNameOrId(Tokens[3]);
+            if (!Owner || (!Target && !bNull))
+            {
+                std::cout << "[Link] Object not found: " << (Owner ? Tokens[3] : Tokens[1]) << "\n";
+                return true;
+            }
+            
+            if (GC.Link(Owner, Tokens[2], Target))
+            {
+                std::cout << "Linked " << Tokens[1] << "." << Tokens[2] << " -> " << Tokens[3] << "\n";
+            }
+            else
+            {
+                std::cout << "Failed to link " << Tokens[1] << "." << Tokens[2] << "\n";
+            }
+            return true;
+        }
         else if (Cmd == "set" && Tokens.size() >= 4)
         {
-            bool bResult = GC.SetPropertyByName(Tokens[1], Tokens[2], Tokens[3]);
+            QObject* Target = GC.FindByNameOrId(Tokens[1]);
+            bool bResult = Target && GC.SetProperty(Target, Tokens[2], Tokens[3]);
             if (bResult)
             {
                 std::cout << "Set " << Tokens[1] << "." << Tokens[2] << " to " << Tokens[3] << "\n";
@@ -677,12 +979,44 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
 
             return true;
         }
+        else if (Cmd == "setall" && Tokens.size() >= 4)
+        {
+            size_t NumSet = 0;
+            if (GC.SetPropertyForAll(Tokens[1], Tokens[2], Tokens[3], NumSet))
+            {
+                std::cout << "Set " << Tokens[1] << "." << Tokens[2] << " to " << Tokens[3] << " on " << NumSet << " object(s)\n";
+            }
+            else
+            {
+                std::cout << "Failed to set " << Tokens[1] << "." << Tokens[2] << "\n";
+            }
+            return true;
+        }
+        else if ((Cmd == "sum" || Cmd == "min" || Cmd == "max") && Tokens.size() >= 3)
+        {
+            GarbageCollector::FPropertyAggregate Aggregate;
+            if (!GC.AggregateProperty(Tokens[1], Tokens[2], Aggregate))
+            {
+                std::cout << "Failed to read " << Tokens[1] << "." << Tokens[2] << "\n";
+                return true;
+            }
+            if (Aggregate.Count == 0)
+            {
+                std::cout << "No instances of " << Tokens[1] << "\n";
+                return true;
+            }
+
+            const qmeta::Variant& Result = (Cmd == "sum") ? Aggregate.Sum : (Cmd == "min") ? Aggregate.Min : Aggregate.Max;
+            std::cout << Cmd << "(" << Tokens[1] << "." << Tokens[2] << ") = " << EngineUtils::FormatPropertyValue(Result)
+                      << " over " << Aggregate.Count << " object(s)\n";
+            return true;
+        }
         else if (Cmd == "call" && Tokens.size() >= 3)
         {
             const std::string& ObjName  = Tokens[1];
             const std::string& FuncName = Tokens[2];
 
-            QObject* Target = GC.FindByDebugName(ObjName);
+            QObject* Target = GC.FindByNameOrId(ObjName);
             if (!Target)
             {
                 std::cout << "[Call] Object not found: " << ObjName << std::endl;
@@ -691,21 +1025,16 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
 
             const qmeta::TypeInfo* Ti = GC.GetTypeInfo(Target);
 
-            // Try to locate function meta (name match)
-            const qmeta::MetaFunction* MetaFunc = nullptr;
+            // Locate function meta (own or inherited) through the per-type call-site cache
+            qmeta::FunctionHandle Handle;
             if (Ti)
             {
-                for (const auto& F : Ti->functions)
-                {
-                    if (F.name == FuncName)
-                    {
-                        MetaFunc = &F; break;
-                    }
-                }
+                Handle = ResolveFunctionCached(*Ti, FuncName);
             }
+            const qmeta::MetaFunction* MetaFunc = Handle.Func;
 
-            std::vector<qmeta::Variant> Args;
-            Args.reserve(Tokens.size() - 3);
+            // Stays on the stack for up to 8 arguments
+            qmeta::InlineArgs<> Args;
 
             bool TypedOk = false;
 
@@ -748,27 +1077,27 @@ bool ConsoleManager::ExecuteCommand(const std::string& Line)
                 }
             }
 
-            // Make the call
-            qmeta::Variant Result = GC.CallByName(ObjName, FuncName, Args);
+            // Make the call (by name only to report a missing function)
+            qmeta::Variant Result = Handle.IsValid() ? GC.Call(Target, Handle, Args) : GC.Call(Target, FuncName, Args);
 
             // Pretty-print return value
             std::string Formatted = EngineUtils::FormatPropertyValue(Result);
             std::cout << Formatted << std::endl;
             return true;
         }
-        else if (Cmd == "save" && Tokens.size() >= 2)
-        {
-            std::cout << "[save] is not implemented for now.\n";
-
-            //const std::string file = (Tokens.size() >= 3 ? Tokens[2] : "");
-            //GC.Save(tokens[1], file);
-            return true;
-        }
-        else if (Cmd == "load" && Tokens.size() >= 3)
+        else if ((Cmd == "save" || Cmd == "load") && Tokens.size() >= 2)
         {
-            std::cout << "[load] is not implemented for now.\n";
-            //const std::string file = (tokens.size() >= 4 ? tokens[3] : "");
-            //GC.Load(tokens[1], tokens[2], file);
+            QObject* Target = GC.FindByNameOrId(Tokens[1]);
+            if (!Target)
+            {
+                std::cout << "[" << Cmd << "] Object not found: " << Tokens[1] << "\n";
+                return true;
+            }
+            
+            const std::string File = (Tokens.size() >= 3 ? Tokens[2] : "");
+            const uint64_t Id = Target->GetObjectId();
+            const bool bResult = (Cmd == "save") ? GC.Save(Id, File) : GC.Load(Id, File);
+            std::cout << "[" << Cmd << "] " << Target->GetDebugName() << (bResult ? " ok" : " failed") << "\n";
             return true;
         }
         else
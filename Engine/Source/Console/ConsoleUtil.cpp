@@ -1,6 +1,7 @@
 ﻿#include "ConsoleUtil.h"
 
 #include <sstream>
+#include <unordered_map>
 
 
 void ConsoleUtil::BuildClassChain(const qmeta::TypeInfo* Ti, std::vector<const qmeta::TypeInfo*>& Out)
@@ -107,13 +108,13 @@ bool ConsoleUtil::ParseTokenByType(const std::string& Token, const std::string&
     {
         if (Tok == "null" || Tok == "nullptr" || Tok == "0")
         {
-            OutVar = Variant((void*)nullptr);
+            OutVar = Variant(static_cast<QObject*>(nullptr));
             return true;
         }
-        // try resolve object by debug name
-        if (QObject* Obj = GC.FindByDebugName(Tok))
+        // try resolve object by debug name or #id
+        if (QObject* Obj = GC.FindByNameOrId(Tok))
         {
-            OutVar = Variant(static_cast<void*>(Obj));
+            OutVar = Variant(Obj);
             return true;
         }
         // as a last resort, allow hex address like 0x1234
@@ -189,9 +190,9 @@ bool ConsoleUtil::ParseTokenByType(const std::string& Token, const std::string&
 qmeta::Variant ConsoleUtil::ParseTokenLenient(const std::string& token, GarbageCollector& GC)
 {
     using qmeta::Variant;
-    if (QObject* Obj = GC.FindByDebugName(token))
+    if (QObject* Obj = GC.FindByNameOrId(token))
     {
-        return Variant(static_cast<void*>(Obj));
+        return Variant(Obj);
     }
     if (token == "true" || token == "false")
     {
@@ -201,3 +202,36 @@ qmeta::Variant ConsoleUtil::ParseTokenLenient(const std::string& token, GarbageC
     try { return Variant(std::stod(token)); } catch (...) {}
     return Variant(token);
 }
+
+const qmeta::FunctionHandle& ConsoleUtil::ResolveFunctionCached(const qmeta::TypeInfo& Ti, const std::string& FuncName)
+{
+    struct FCallSiteKey
+    {
+        const qmeta::TypeInfo* Type;
+        FName Name;
+        bool operator==(const FCallSiteKey&) const = default;
+    };
+    struct FCallSiteKeyHash
+    {
+        size_t operator()(const FCallSiteKey& Key) const noexcept
+        {
+            return std::hash<const void*>()(Key.Type) ^ (std::hash<FName>()(Key.Name) * 31);
+        }
+    };
+    static std::unordered_map<FCallSiteKey, qmeta::FunctionHandle, FCallSiteKeyHash> Cache;
+    static const qmeta::FunctionHandle Unresolved;
+
+    // Never-interned names cannot name a function; don't let typos grow the cache.
+    const FName Name = FName::Find(FuncName);
+    if (Name.IsNone())
+    {
+        return Unresolved;
+    }
+
+    auto [It, bInserted] = Cache.try_emplace(FCallSiteKey{ &Ti, Name });
+    if (bInserted)
+    {
+        It->second = qmeta::FunctionHandle::Resolve(Ti, Name);
+    }
+    return It->second;
+}
@@ -34,6 +34,10 @@ namespace ConsoleUtil
     // Parse one token to Variant using expected param type. Returns true on success.
     bool ParseTokenByType(const std::string& Token, const std::string& ExpectedTypeRaw, GarbageCollector& GC, qmeta::Variant& OutVar);
 
-    // Lenient parse when no meta signature is available: object-name -> QObject*, else old rules
+    // Lenient parse when no meta signature is available: object-name or #id -> QObject*, else old rules
     qmeta::Variant ParseTokenLenient(const std::string& token, GarbageCollector& GC);
+
+    // Inline cache for console calls, keyed by (type, function name): the name is resolved once per type and the
+    // handle reused by every later call. Invalid handle if the type has no such function.
+    const qmeta::FunctionHandle& ResolveFunctionCached(const qmeta::TypeInfo& Ti, const std::string& FuncName);
 }
@@ -0,0 +1,103 @@
+﻿#include "FrameArena.h"
+
+#include <cstdint>
+#include <iostream>
+#include <new>
+#include <unordered_set>
+
+#include "GarbageCollector.h"
+#include "Object.h"
+
+FFrameArena& FFrameArena::Get()
+{
+    static FFrameArena Arena;
+    return Arena;
+}
+
+FFrameArena::~FFrameArena()
+{
+    // Static teardown: the GC may already be gone, so no escape check here.
+    DestroyObjectsFrom(0);
+}
+
+void* FFrameArena::Allocate(const size_t Size, const size_t Alignment)
+{
+    if (Size + Alignment > BlockSize)
+    {
+        throw std::bad_alloc();
+    }
+
+    for (;;)
+    {
+        if (CurrentBlock == Blocks.size())
+        {
+            Blocks.push_back(std::make_unique<unsigned char[]>(BlockSize));
+        }
+
+        const uintptr_t Base = reinterpret_cast<uintptr_t>(Blocks[CurrentBlock].get());
+        const uintptr_t Start = (Base + Offset + Alignment - 1) & ~(uintptr_t(Alignment) - 1);
+        if (Start + Size <= Base + BlockSize)
+        {
+            Offset = Start + Size - Base;
+            return reinterpret_cast<void*>(Start);
+        }
+
+        ++CurrentBlock;
+        Offset = 0;
+    }
+}
+
+void FFrameArena::PopMark(const FMark& Mark)
+{
+    if (Objects.size() > Mark.NumObjects)
+    {
+#ifndef NDEBUG
+        ReportEscapes(Mark);
+#endif
+
+        DestroyObjectsFrom(Mark.NumObjects);
+    }
+
+    CurrentBlock = Mark.BlockIndex;
+    Offset = Mark.Offset;
+}
+
+void FFrameArena::DestroyObjectsFrom(const size_t First)
+{
+    // Reverse creation order, so an object can still use anything created before it.
+    // Transient objects skip the pending-kill list: teardown must finish inside BeginDestroy()/FinishDestroy().
+    for (size_t i = Objects.size(); i-- > First; )
+    {
+        QObject* Obj = Objects[i];
+        Obj->BeginDestroy();
+        Obj->FinishDestroy();
+        Obj->~QObject();
+    }
+    Objects.resize(First);
+}
+
+bool FFrameArena::Contains(const void* Ptr) const
+{
+    const unsigned char* P = static_cast<const unsigned char*>(Ptr);
+    for (const auto& Block : Blocks)
+    {
+        if (P >= Block.get() && P < Block.get() + BlockSize)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t FFrameArena::ReportEscapes(const FMark& Mark) const
+{
+    std::unordered_set<const QObject*> Released(Objects.begin() + static_cast<ptrdiff_t>(Mark.NumObjects), Objects.end());
+    
+    return GarbageCollector::Get().FindReferencesTo(
+        [&](const QObject* Target) { return Released.contains(Target); },
+        [](const QObject* Owner, const QObject* Target)
+        {
+            std::cout << "[FrameArena] Escape: " << Owner->GetDebugName() << " still references transient "
+                      << Target->GetDebugName() << "\n";
+        });
+}
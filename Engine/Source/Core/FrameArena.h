@@ -0,0 +1,76 @@
+﻿#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class QObject;
+
+// Bump arena for QObjects that never outlive the current frame.
+// Objects from NewTransientObject<T>() are not registered with the GC: they are never traced or swept and cost
+// nothing at collection time. The main loop calls EndFrame() after every tick, which destroys them in reverse
+// creation order and rewinds the arena; FFrameArenaScope releases earlier for work that ends mid-frame.
+// Transient objects are not roots either: a managed object referenced only by a transient one can be collected.
+// Game thread only.
+class FFrameArena
+{
+public:
+    static constexpr size_t BlockSize = 256 * 1024;
+
+    static FFrameArena& Get();
+
+    FFrameArena() = default;
+    ~FFrameArena();
+
+    FFrameArena(const FFrameArena&) = delete;
+    FFrameArena& operator=(const FFrameArena&) = delete;
+
+    // Throws std::bad_alloc for sizes that do not fit in one block.
+    void* Allocate(size_t Size, size_t Alignment);
+
+    // Takes ownership of an object constructed in Allocate()d storage.
+    void AddObject(QObject* Obj) { Objects.push_back(Obj); }
+
+    struct FMark
+    {
+        size_t BlockIndex = 0;
+        size_t Offset = 0;
+        size_t NumObjects = 0;
+    };
+    FMark GetMark() const { return { CurrentBlock, Offset, Objects.size() }; }
+
+    // Destroys objects created after Mark and rewinds to it.
+    void PopMark(const FMark& Mark);
+
+    // Releases everything. Blocks are kept for the next frame.
+    void EndFrame() { PopMark(FMark{}); }
+
+    bool Contains(const void* Ptr) const;
+    size_t GetNumObjects() const { return Objects.size(); }
+    size_t GetReservedBytes() const { return Blocks.size() * BlockSize; }
+
+    // Logs each reflected reference from a GC-managed object to a transient object created after Mark.
+    // Returns the count. Debug builds run it on every release.
+    size_t ReportEscapes(const FMark& Mark) const;
+
+private:
+    void DestroyObjectsFrom(size_t First);
+
+    std::vector<std::unique_ptr<unsigned char[]>> Blocks;
+    size_t CurrentBlock = 0;
+    size_t Offset = 0;
+    std::vector<QObject*> Objects;
+};
+
+// Releases transient objects created inside the scope when it ends.
+class FFrameArenaScope
+{
+public:
+    FFrameArenaScope() : Mark(FFrameArena::Get().GetMark()) {}
+    ~FFrameArenaScope() { FFrameArena::Get().PopMark(Mark); }
+
+    FFrameArenaScope(const FFrameArenaScope&) = delete;
+    FFrameArenaScope& operator=(const FFrameArenaScope&) = delete;
+
+private:
+    FFrameArena::FMark Mark;
+};
@@ -4,8 +4,23 @@
 #include <sstream>
 #include <algorithm>
 #include <unordered_set>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <thread>
+#include <limits>
 
 #include "Asset.h"
+#include "GcSafepoint.h"
+#include "PropertyTypeOps.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 using qmeta::TypeInfo;
 using qmeta::MetaProperty;
@@ -52,7 +67,79 @@ static inline std::string Strip(std::string s)
     return s;
 }
 
-void GarbageCollector::RegisterInternal(QObject* Obj, const TypeInfo& Ti, const std::string& Name, uint64_t Id)
+void GarbageCollector::RegisterInternal(QObject* Obj, const TypeInfo& Ti, uint64_t Id)
+{
+    if (!IsGameThread())
+    {
+        FRegistrationBuffer& Buffer = GetThreadRegistrationBuffer();
+        std::lock_guard<std::mutex> Lock(Buffer.Mutex);
+        Buffer.Items.emplace(Obj, FPendingRegistration{&Ti, Id});
+        return;
+    }
+    
+    RegisterNow(Obj, Ti, Id);
+
+    // Region ownership is game-thread state: objects merged from other threads stay unowned.
+    if (!RootRegionStack.empty() && RootRegionStack.back() >= 0 && PermanentRegionStack.empty())
+    {
+        AddToRegion(Obj, Objects.find(Obj)->second, RootRegionStack.back());
+    }
+}
+
+GarbageCollector::FRegistrationBuffer& GarbageCollector::GetThreadRegistrationBuffer()
+{
+    // The GC keeps its own reference, so objects buffered by a thread that has exited are still merged.
+    thread_local std::shared_ptr<FRegistrationBuffer> Buffer;
+    if (!Buffer)
+    {
+        Buffer = std::make_shared<FRegistrationBuffer>();
+        std::lock_guard<std::mutex> Lock(RegistrationBuffersMutex);
+        RegistrationBuffers.push_back(Buffer);
+    }
+    return *Buffer;
+}
+
+size_t GarbageCollector::FlushRegistrations()
+{
+    FGcStopTheWorldScope StopScope;
+    return FlushRegistrationsInternal(nullptr);
+}
+
+size_t GarbageCollector::FlushRegistrationsInternal(std::vector<QObject*>* OutMerged)
+{
+    std::lock_guard<std::mutex> Lock(RegistrationBuffersMutex);
+    
+    size_t NumMerged = 0;
+    std::unordered_map<QObject*, FPendingRegistration> Items;
+    for (const std::shared_ptr<FRegistrationBuffer>& Buffer : RegistrationBuffers)
+    {
+        {
+            std::lock_guard<std::mutex> BufferLock(Buffer->Mutex);
+            Items.swap(Buffer->Items);
+        }
+        
+        for (auto& [Obj, Pending] : Items)
+        {
+            RegisterNow(Obj, *Pending.Ti, Pending.Id);
+            if (OutMerged)
+            {
+                OutMerged->push_back(Obj);
+            }
+        }
+        NumMerged += Items.size();
+        Items.clear();
+    }
+
+    // Drop buffers of exited threads (only our reference is left, and it was just drained).
+    std::erase_if(RegistrationBuffers, [](const std::shared_ptr<FRegistrationBuffer>& Buffer)
+    {
+        return Buffer.use_count() == 1;
+    });
+    
+    return NumMerged;
+}
+
+void GarbageCollector::RegisterNow(QObject* Obj, const TypeInfo& Ti, uint64_t Id)
 {
     Node N;
     N.Ti = &Ti;
@@ -64,10 +151,70 @@ void GarbageCollector::RegisterInternal(QObject* Obj, const TypeInfo& Ti, const
         N.Layout = GetPtrLayout(Ti);
     }
     
-    Objects.emplace(Obj, N);
+    {
+        std::lock_guard<std::mutex> Lock(AllocatorMutex);
+        Allocator.SetLive(Obj, true);
+    }
+    
+    AddInstance(Obj, N);
+
+    if (!PermanentRegionStack.empty())
+    {
+        PermanentObjects.emplace(Obj, N);
+        Obj->SetFlags(OF_Permanent);
+        if (PermanentRegionStack.back())
+        {
+            PermanentRootSources.push_back(Obj);
+        }
+    }
+    else
+    {
+        Objects.emplace(Obj, N);
+    }
     
-    //ById[Id] = Obj;
-    NameToObjectMap[Name] = Obj;
+    SetIdSlot(Id, Obj);
+}
+
+void GarbageCollector::SetIdSlot(uint64_t Id, QObject* Obj)
+{
+    const size_t PageIndex = static_cast<size_t>(Id >> IdPageShift);
+    if (PageIndex >= IdPages.size())
+    {
+        IdPages.resize(PageIndex + 1);
+    }
+
+    FIdPage& Page = IdPages[PageIndex];
+    if (!Page.Slots)
+    {
+        Page.Slots = std::make_unique<QObject*[]>(IdPageSize); // value-initialized: all tombstones
+    }
+
+    QObject*& Slot = Page.Slots[Id & (IdPageSize - 1)];
+    if (!Slot)
+    {
+        ++Page.NumLive;
+    }
+    Slot = Obj;
+}
+
+void GarbageCollector::ClearIdSlot(uint64_t Id)
+{
+    const size_t PageIndex = static_cast<size_t>(Id >> IdPageShift);
+    if (PageIndex >= IdPages.size() || !IdPages[PageIndex].Slots)
+    {
+        return;
+    }
+
+    FIdPage& Page = IdPages[PageIndex];
+    QObject*& Slot = Page.Slots[Id & (IdPageSize - 1)];
+    if (Slot)
+    {
+        Slot = nullptr;
+        if (--Page.NumLive == 0)
+        {
+            Page.Slots.reset();
+        }
+    }
 }
 
 void GarbageCollector::RegisterTypeFactory(const std::string& TypeName, FactoryFunc Fn)
@@ -103,19 +250,237 @@ void GarbageCollector::Initialize()
 void GarbageCollector::AddRoot(QObject* Obj)
 {
     if (!Obj) return;
-    if (std::find(Roots.begin(), Roots.end(), Obj) == Roots.end())
+
+    // The object may be garbage in a pending fork snapshot.
+    ForkCollect.bInvalidated = true;
+    
+    auto [It, bInserted] = RootSlots.try_emplace(Obj);
+    if (bInserted)
     {
+        It->second.Index = static_cast<uint32_t>(Roots.size());
         Roots.push_back(Obj);
     }
+    ++It->second.PinCount;
 }
 
 void GarbageCollector::RemoveRoot(QObject* Obj)
 {
-    Roots.erase(std::remove(Roots.begin(), Roots.end(), Obj), Roots.end());
+    auto It = RootSlots.find(Obj);
+    if (It == RootSlots.end()) return;
+
+    if (--It->second.PinCount > 0)
+    {
+        return;
+    }
+
+    // Swap-remove: move the last root into the freed slot.
+    const uint32_t Index = It->second.Index;
+    QObject* Last = Roots.back();
+    Roots[Index] = Last;
+    RootSlots[Last].Index = Index;
+    Roots.pop_back();
+    RootSlots.erase(It);
+}
+
+void GarbageCollector::BeginPermanentRegion(bool bReferencesAsRoots)
+{
+    PermanentRegionStack.push_back(bReferencesAsRoots);
+}
+
+void GarbageCollector::EndPermanentRegion()
+{
+    if (!PermanentRegionStack.empty())
+    {
+        PermanentRegionStack.pop_back();
+    }
+}
+
+bool GarbageCollector::MakePermanent(QObject* Obj, bool bReferencesAsRoots)
+{
+    auto It = Objects.find(Obj);
+    if (It == Objects.end())
+    {
+        return false;
+    }
+
+    if (It->second.ClusterIndex >= 0)
+    {
+        DissolveCluster(Obj);
+    }
+    RemoveFromRegion(Obj, It->second);
+
+    Node N = It->second;
+    N.ClusterIndex = -1;
+    Objects.erase(It);
+    PermanentObjects.emplace(Obj, N);
+    // MarkFromRoot recognizes permanent roots and sources by this flag.
+    Obj->SetFlags(OF_Permanent);
+
+    if (bReferencesAsRoots)
+    {
+        PermanentRootSources.push_back(Obj);
+    }
+    return true;
+}
+
+void GarbageCollector::BeginRootRegion(QObject* Root)
+{
+    auto RootIt = Objects.find(Root);
+    if (RootIt == Objects.end())
+    {
+        // Permanent and unmanaged objects cannot own a region; keep the stack balanced.
+        RootRegionStack.push_back(-1);
+        return;
+    }
+
+    auto [It, bInserted] = RegionByRoot.try_emplace(Root, -1);
+    if (bInserted)
+    {
+        int32_t Index;
+        if (!FreeRegionIndices.empty())
+        {
+            Index = FreeRegionIndices.back();
+            FreeRegionIndices.pop_back();
+        }
+        else
+        {
+            Index = static_cast<int32_t>(Regions.size());
+            Regions.emplace_back();
+        }
+        Regions[Index].Root = Root;
+        It->second = Index;
+
+        // A root always belongs to its own region, even when it was created inside another one.
+        Node& RootNode = RootIt->second;
+        if (RootNode.RegionIndex >= 0)
+        {
+            Regions[RootNode.RegionIndex].Members.erase(Root);
+        }
+        AddToRegion(Root, RootNode, Index);
+    }
+    
+    RootRegionStack.push_back(It->second);
+}
+
+void GarbageCollector::EndRootRegion()
+{
+    if (!RootRegionStack.empty())
+    {
+        RootRegionStack.pop_back();
+    }
+}
+
+bool GarbageCollector::RemoveRootRegion(QObject* Root)
+{
+    if (!RegionByRoot.contains(Root))
+    {
+        return false;
+    }
+    
+    // The root may already have left Objects (made permanent, pending kill); the region is released either way.
+    Node Detached;
+    auto It = Objects.find(Root);
+    RemoveFromRegion(Root, It != Objects.end() ? It->second : Detached);
+    return true;
+}
+
+size_t GarbageCollector::GetRegionSize(const QObject* Root) const
+{
+    auto It = RegionByRoot.find(const_cast<QObject*>(Root));
+    return It == RegionByRoot.end() ? 0 : Regions[It->second].Members.size();
+}
+
+void GarbageCollector::AddToRegion(QObject* Obj, Node& N, int32_t Index)
+{
+    N.RegionIndex = Index;
+    Regions[Index].Members.insert(Obj);
+}
+
+void GarbageCollector::RemoveFromRegion(QObject* Obj, Node& N)
+{
+    if (N.RegionIndex >= 0)
+    {
+        Regions[N.RegionIndex].Members.erase(Obj);
+        N.RegionIndex = -1;
+    }
+
+    auto RootIt = RegionByRoot.find(Obj);
+    if (RootIt == RegionByRoot.end())
+    {
+        return;
+    }
+
+    const int32_t Index = RootIt->second;
+    RegionByRoot.erase(RootIt);
+    
+    for (QObject* Member : Regions[Index].Members)
+    {
+        if (auto It = Objects.find(Member); It != Objects.end())
+        {
+            It->second.RegionIndex = -1;
+        }
+    }
+    Regions[Index] = FRootRegion();
+    FreeRegionIndices.push_back(Index);
+
+    // Scopes still open for this root stop assigning ownership.
+    std::replace(RootRegionStack.begin(), RootRegionStack.end(), Index, -1);
+}
+
+void GarbageCollector::NoteCrossRegionRef(int32_t OwnerRegion, QObject* Target)
+{
+    auto It = Objects.find(Target);
+    if (It == Objects.end())
+    {
+        return;
+    }
+
+    const int32_t TargetRegion = It->second.RegionIndex;
+    if (TargetRegion >= 0 && TargetRegion != OwnerRegion && Regions[TargetRegion].Root != Target)
+    {
+        Regions[TargetRegion].bHasIncomingRefs = true;
+    }
+}
+
+const GarbageCollector::Node* GarbageCollector::FindNode(const QObject* Obj) const
+{
+    QObject* Key = const_cast<QObject*>(Obj);
+    if (auto It = Objects.find(Key); It != Objects.end())
+    {
+        return &It->second;
+    }
+    if (auto It = PermanentObjects.find(Key); It != PermanentObjects.end())
+    {
+        return &It->second;
+    }
+    return nullptr;
+}
+
+uint32_t GarbageCollector::GetRootPinCount(const QObject* Obj) const
+{
+    auto It = RootSlots.find(const_cast<QObject*>(Obj));
+    return It == RootSlots.end() ? 0 : It->second.PinCount;
 }
 
 void GarbageCollector::Tick(double DeltaSeconds)
 {
+    if (ForkCollect.Pid > 0)
+    {
+        FinishForkCollect();
+    }
+
+    // Frame boundary: no reflected method is running, so no `this` can be moved under it.
+    if (bCompactPending)
+    {
+        bCompactPending = false;
+        Compact(bCompactPendingSilent);
+    }
+    
+    if (!PendingKill.empty())
+    {
+        ProcessPendingKill();
+    }
+    
     Accumulated += DeltaSeconds;
     if (Interval > 0.0 && Accumulated >= Interval)
     {
@@ -129,6 +494,35 @@ void GarbageCollector::SetAutoInterval(double Seconds)
     Interval = Seconds;
 }
 
+size_t GarbageCollector::ProcessPendingKill(bool bWaitAll)
+{
+    size_t NumFinished = 0;
+    while (!PendingKill.empty())
+    {
+        for (size_t i = 0; i < PendingKill.size(); )
+        {
+            FPendingKill Pending = PendingKill[i];
+            if (!Pending.Obj->IsReadyForFinishDestroy())
+            {
+                ++i;
+                continue;
+            }
+            
+            PendingKill[i] = PendingKill.back();
+            PendingKill.pop_back();
+            DestroyObject(Pending.Obj, *Pending.Ti);
+            ++NumFinished;
+        }
+
+        if (!bWaitAll || PendingKill.empty())
+        {
+            break;
+        }
+        std::this_thread::yield();
+    }
+    return NumFinished;
+}
+
 // Helpers
 static inline bool EndsWithStar(const std::string& s)
 {
@@ -162,25 +556,29 @@ bool GarbageCollector::IsManaged(const QObject* Obj) const
         return false;
     }
     
-    return Objects.contains(const_cast<QObject*>(Obj));
+    // Slab-backed objects answer from the page map and live bits without touching the object maps or taking
+    // AllocatorMutex: both queries are lock-free.
+    if (Allocator.OwnsAddress(Obj))
+    {
+        return Allocator.IsLiveObject(Obj);
+    }
+    return FindNode(Obj) != nullptr;
 }
 
 void GarbageCollector::MarkParallelPerRoot(std::vector<std::pair<std::string, size_t>>* OutStats)
 {
     // Idealized model: one thread per root, isolated graphs, no synchronization.
-    // Copy roots to avoid concurrent mutation issues if caller modifies Roots later.
-    std::vector<QObject*> LocalRoots = Roots;
-
+    // Roots cannot change during a collection, so they are iterated in place.
     std::vector<std::thread> Threads;
-    Threads.reserve(LocalRoots.size());
+    Threads.reserve(Roots.size() + PermanentRootSources.size());
 
     std::mutex StatsMutex;
     
-    for (QObject* Root : LocalRoots)
+    auto Spawn = [&](QObject* Root)
     {
         if (!Root)
         {
-            continue;
+            return;
         }
         Threads.emplace_back([this, Root, OutStats, &StatsMutex]()
         {
@@ -193,6 +591,15 @@ void GarbageCollector::MarkParallelPerRoot(std::vector<std::pair<std::string, si
                 OutStats->emplace_back(Nm, Visited);
             }
         });
+    };
+    
+    for (QObject* Root : Roots)
+    {
+        Spawn(Root);
+    }
+    for (QObject* Source : PermanentRootSources)
+    {
+        Spawn(Source);
     }
 
     for (auto& T : Threads)
@@ -281,11 +688,44 @@ const GarbageCollector::FPtrOffsetLayout* GarbageCollector::GetPtrLayout(const q
         Cur = Cur->base;
     }
 
+    // Pointer bitmap: reflected QObject* members are always pointer-aligned, so word = offset / sizeof(void*).
+    for (size_t Offset : Layout->RawOffsets)
+    {
+        const size_t Word = Offset / sizeof(void*);
+        if (Word / 64 >= Layout->PtrBitmap.size())
+        {
+            Layout->PtrBitmap.resize(Word / 64 + 1, 0);
+        }
+        Layout->PtrBitmap[Word / 64] |= uint64_t(1) << (Word % 64);
+    }
+
+    Layout->bNoReferences = Layout->RawOffsets.empty() && Layout->VecOffsets.empty();
+
     const FPtrOffsetLayout* StablePtr = Layout.get();
     PtrCache.emplace(&Ti, std::move(Layout));
     return StablePtr;
 }
 
+template <class F>
+void GarbageCollector::ForEachRawSlot(unsigned char* Base, const FPtrOffsetLayout& Layout, const F& Func)
+{
+    QObject** Words = reinterpret_cast<QObject**>(Base);
+    for (size_t W = 0; W < Layout.PtrBitmap.size(); ++W)
+    {
+        uint64_t Bits = Layout.PtrBitmap[W];
+        while (Bits)
+        {
+            const size_t Word = W * 64 + static_cast<size_t>(std::countr_zero(Bits));
+            Bits &= Bits - 1; // clear lowest set bit
+            
+            if (Words[Word])
+            {
+                Func(Words[Word]);
+            }
+        }
+    }
+}
+
 void GarbageCollector::Mark()
 {
     // Sequential over roots (single-thread path).
@@ -294,6 +734,10 @@ void GarbageCollector::Mark()
     {
         if (Root) MarkFromRoot(Root);
     }
+    for (QObject* Source : PermanentRootSources)
+    {
+        MarkFromRoot(Source);
+    }
 }
 
 size_t GarbageCollector::MarkFromRoot(QObject* Root)
@@ -305,51 +749,99 @@ size_t GarbageCollector::MarkFromRoot(QObject* Root)
     
     size_t Visited = 0;
     
-    std::vector<QObject*> Stack;
+    std::vector<std::pair<QObject*, const Node*>> Stack;
     Stack.reserve(64);
-    Stack.push_back(Root);
 
-    while (!Stack.empty())
-    {
-        QObject* Cur = Stack.back();
-        Stack.pop_back();
+    // Clusters reached but not yet expanded (external refs + root slots).
+    std::vector<const FGcCluster*> ClusterStack;
 
-        auto ObjIter = Objects.find(Cur);
+    // Marks on discovery. Leaf objects and ignored subtrees are never pushed, so they are never scanned.
+    auto Visit = [&](QObject* Obj)
+    {
+        auto ObjIter = Objects.find(Obj);
         if (ObjIter == Objects.end())
         {
-            continue;
+            return;
         }
 
         Node& N = ObjIter->second;
+
+        // Any member reached marks the whole cluster at once.
+        if (N.ClusterIndex >= 0)
+        {
+            FGcCluster& Cluster = Clusters[N.ClusterIndex];
+            if (Cluster.MarkEpoch == CurrentEpoch)
+            {
+                return;
+            }
+            
+            Cluster.MarkEpoch = CurrentEpoch;
+            Visited += Cluster.Members.size();
+            ClusterStack.push_back(&Cluster);
+            return;
+        }
         
         // Already marked in this epoch?
         if (N.MarkEpoch == CurrentEpoch)
         {
-            continue;
+            return;
         }
-
-        // Mark
+        
         N.MarkEpoch = CurrentEpoch;
         ++Visited;
+
+        if (N.Layout->bNoReferences || Obj->IsGcIgnoredSelfAndBelow())
+        {
+            return;
+        }
         
-        if (Cur->bGcIgnoredSelfAndBelow)
+        Stack.emplace_back(Obj, &N);
+    };
+
+    // Permanent roots are never marked themselves, only their references are scanned.
+    if (Root->HasAnyFlags(OF_Permanent))
+    {
+        auto PermIter = PermanentObjects.find(Root);
+        if (PermIter != PermanentObjects.end() && !PermIter->second.Layout->bNoReferences && !Root->IsGcIgnoredSelfAndBelow())
+        {
+            Stack.emplace_back(Root, &PermIter->second);
+        }
+    }
+    else
+    {
+        Visit(Root);
+    }
+    
+    while (!Stack.empty() || !ClusterStack.empty())
+    {
+        if (!ClusterStack.empty())
         {
+            const FGcCluster* Cluster = ClusterStack.back();
+            ClusterStack.pop_back();
+
+            for (QObject* Ext : Cluster->ExternalRefs)
+            {
+                Visit(Ext);
+            }
+
+            // The cluster root stays mutable, so its own slots are still scanned.
+            auto RootIter = Objects.find(Cluster->Root);
+            if (RootIter != Objects.end() && !RootIter->second.Layout->bNoReferences)
+            {
+                Stack.emplace_back(Cluster->Root, &RootIter->second);
+            }
             continue;
         }
         
+        auto [Cur, N] = Stack.back();
+        Stack.pop_back();
+        
         // Use cached layout (pre-filled in RegisterInternal), so no PtrCache contention.
-        const FPtrOffsetLayout& Layout = *N.Layout;
+        const FPtrOffsetLayout& Layout = *N->Layout;
         unsigned char* Base = BytePtr(Cur);
 
         // Raw QObject* fields
-        for (size_t Offset : Layout.RawOffsets)
-        {
-            QObject* const* Slot = reinterpret_cast<QObject* const*>(Base + Offset);
-            if (Slot && *Slot && IsManaged(*Slot))
-            {
-                Stack.push_back(*Slot);
-            }
-        }
+        ForEachRawSlot(Base, Layout, Visit);
 
         // std::vector<QObject*> fields
         for (size_t Offset : Layout.VecOffsets)
@@ -357,9 +849,9 @@ size_t GarbageCollector::MarkFromRoot(QObject* Root)
             const auto* Vec = reinterpret_cast<const std::vector<QObject*>*>(Base + Offset);
             for (QObject* Child : *Vec)
             {
-                if (Child && IsManaged(Child))
+                if (Child)
                 {
-                    Stack.push_back(Child);
+                    Visit(Child);
                 }
             }
         }
@@ -368,18 +860,8 @@ size_t GarbageCollector::MarkFromRoot(QObject* Root)
     return Visited;
 }
 
-double GarbageCollector::Collect(bool bSilent)
+void GarbageCollector::BeginMarkEpoch()
 {
-    using Clock = std::chrono::high_resolution_clock;
-    auto ms = [](const Clock::time_point& a, const Clock::time_point& b)
-    {
-        return std::chrono::duration<double, std::milli>(a - b).count();
-    };
-
-    const auto TTotal0 = Clock::now();
-
-    // 1) Clear marks
-    const auto TClear0 = Clock::now();
     CurrentEpoch++;
     if (CurrentEpoch == 0)
     {
@@ -388,9 +870,173 @@ double GarbageCollector::Collect(bool bSilent)
         {
             Node.MarkEpoch = 0;   
         }
+        for (FGcCluster& Cluster : Clusters)
+        {
+            Cluster.MarkEpoch = 0;
+        }
         CurrentEpoch = 1;
     }
+}
+
+void GarbageCollector::ClearDeadRefs(QObject* Obj, const FPtrOffsetLayout& Layout, const std::unordered_set<QObject*>& DeadSet)
+{
+    unsigned char* Base = BytePtr(Obj);
+
+    ForEachRawSlot(Base, Layout, [&](QObject*& Slot)
+    {
+        if (DeadSet.contains(Slot))
+        {
+            Slot = nullptr;
+        }
+    });
+    
+    for (size_t Offset : Layout.VecOffsets)
+    {
+        auto* Vec = reinterpret_cast<std::vector<QObject*>*>(Base + Offset);
+        std::erase_if(*Vec,[&](QObject* p){ return p && DeadSet.count(p); });
+    }
+}
+
+template <class FIsLive>
+void GarbageCollector::FixupSurvivors(const std::unordered_set<QObject*>& DeadSet, const FIsLive& IsLive)
+{
+    // Every surviving reference is visited here anyway, so region ownership is re-checked in the same pass.
+    const bool bTrackRegions = !RegionByRoot.empty();
+    for (FRootRegion& Region : Regions)
+    {
+        Region.bHasIncomingRefs = false;
+    }
+    bRegionRefsDirty = false;
+    
+    auto NoteRegionRefs = [&](QObject* Obj, const Node& N)
+    {
+        if (Obj->IsGcIgnoredSelfAndBelow())
+        {
+            return;
+        }
+        
+        unsigned char* Base = BytePtr(Obj);
+        auto Note = [&](QObject* Target) { NoteCrossRegionRef(N.RegionIndex, Target); };
+        ForEachRawSlot(Base, *N.Layout, Note);
+        for (size_t Offset : N.Layout->VecOffsets)
+        {
+            for (QObject* Target : *reinterpret_cast<const std::vector<QObject*>*>(Base + Offset))
+            {
+                if (Target) Note(Target);
+            }
+        }
+    };
+
+    for (auto& [Obj, Node] : Objects)
+    {
+        if (Node.Layout->bNoReferences || !IsLive(Obj, Node))
+        {
+            continue;
+        }
+        
+        ClearDeadRefs(Obj, *Node.Layout, DeadSet);
+        if (bTrackRegions)
+        {
+            NoteRegionRefs(Obj, Node);
+        }
+    }
+
+    // Permanent objects are not in Objects, but the ones that are scanned as roots (the world, flagged sources)
+    // reference the normal heap.
+    if (bTrackRegions)
+    {
+        auto NotePermanent = [&](QObject* Source)
+        {
+            auto It = PermanentObjects.find(Source);
+            if (It != PermanentObjects.end() && !It->second.Layout->bNoReferences)
+            {
+                NoteRegionRefs(Source, It->second);
+            }
+        };
+        for (QObject* Source : PermanentRootSources)
+        {
+            NotePermanent(Source);
+        }
+        for (QObject* Root : Roots)
+        {
+            NotePermanent(Root);
+        }
+    }
+}
+
+void GarbageCollector::SweepDead(const std::vector<QObject*>& Dead)
+{
+    for (QObject* D : Dead)
+    {
+        auto It = Objects.find(D);
+        if (It != Objects.end())
+        {
+            // Unreachable cluster: every member is in Dead, release the slot once.
+            const int32_t ClusterIndex = It->second.ClusterIndex;
+            if (ClusterIndex >= 0 && Clusters[ClusterIndex].Root)
+            {
+                ReleaseCluster(ClusterIndex);
+            }
+            RemoveFromRegion(D, It->second);
+            
+            QObject* Obj = It->first;
+            const TypeInfo& Ti = *It->second.Ti;
+            ClearIdSlot(It->second.Id);
+            RemoveInstance(Obj, It->second);
+            Objects.erase(It);            // remove from the list first
+            
+            // Not managed any more, even if the storage outlives this pause.
+            {
+                std::lock_guard<std::mutex> Lock(AllocatorMutex);
+                Allocator.SetLive(Obj, false);
+            }
+            Obj->SetFlags(OF_PendingKill);
+            Obj->BeginDestroy();
+            if (Obj->IsReadyForFinishDestroy())
+            {
+                DestroyObject(Obj, Ti);   // then destroy, keeping memory in the pool
+            }
+            else
+            {
+                PendingKill.push_back({Obj, &Ti});
+            }
+        }
+    }
+}
+
+double GarbageCollector::Collect(bool bSilent)
+{
+    if (Mode == EGcMode::Fork)
+    {
+        return BeginForkCollect(bSilent);
+    }
     
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](const Clock::time_point& a, const Clock::time_point& b)
+    {
+        return std::chrono::duration<double, std::milli>(a - b).count();
+    };
+
+    // Park every registered mutator before touching the heap.
+    FGcStopTheWorldScope StopScope;
+    const FGcStopStats& Stop = StopScope.GetStats();
+
+    const auto TTotal0 = Clock::now();
+
+    // 0) Merge objects created off the game thread. They are traced as roots below for this collection only,
+    //    as are objects found on thread stacks.
+    std::vector<QObject*> Merged;
+    FlushRegistrationsInternal(&Merged);
+
+    std::vector<QObject*> StackRoots;
+    if (bConservativeStackScan)
+    {
+        GatherStackRoots(StackRoots);
+    }
+
+    // 1) Clear marks
+    const auto TClear0 = Clock::now();
+    BeginMarkEpoch();
     const auto TClear1 = Clock::now();
 
     // 2) Mark from roots
@@ -407,6 +1053,15 @@ double GarbageCollector::Collect(bool bSilent)
     {
         Mark();
     }
+    
+    for (QObject* Obj : Merged)
+    {
+        MarkFromRoot(Obj);
+    }
+    for (QObject* Obj : StackRoots)
+    {
+        MarkFromRoot(Obj);
+    }
     const auto TMark1 = Clock::now();
 
     // 3) Build a list of dead objects (no mark)
@@ -414,10 +1069,14 @@ double GarbageCollector::Collect(bool bSilent)
     std::vector<QObject*> Dead; Dead.reserve(Objects.size());
     for (auto& [Obj, Node] : Objects)
     {
-        if (Node.MarkEpoch != CurrentEpoch)
+        if (!IsMarked(Node))
         {
             Dead.push_back(Obj);
-        }   
+        }
+        else if (Node.SurvivedCount < UINT16_MAX)
+        {
+            ++Node.SurvivedCount;
+        }
     }
     const auto TBuild1 = Clock::now();
     const double MsBuild = ms(TBuild1, TBuild0);
@@ -431,46 +1090,14 @@ double GarbageCollector::Collect(bool bSilent)
         DeadSet.insert(d);
     }
 
-    for (auto& [Obj, Node] : Objects)
-    {
-        if (Node.MarkEpoch != CurrentEpoch)
-        {
-            continue;
-        }
-        
-        unsigned char* Base = BytePtr(Obj);
-        const FPtrOffsetLayout* Layout = GetPtrLayout(*Node.Ti);
-
-        for (size_t Offset : Layout->RawOffsets)
-        {
-            QObject** Slot = reinterpret_cast<QObject**>(Base + Offset);
-            if (Slot && *Slot && DeadSet.contains(*Slot))
-            {
-                *Slot = nullptr;
-            }
-        }
-        for (size_t Offset : Layout->VecOffsets)
-        {
-            auto* Vec = reinterpret_cast<std::vector<QObject*>*>(Base + Offset);
-            std::erase_if(*Vec,[&](QObject* p){ return p && DeadSet.count(p); });
-        }
-    }
+    FixupSurvivors(DeadSet, [this](QObject*, const Node& N) { return IsMarked(N); });
     
     const auto TFix1 = Clock::now();
     const double MsFixup = ms(TFix1, TFix0);
 
     // 5) Sweep (Delete the dead and remove from maps)
     const auto TSweep0 = Clock::now();
-    for (QObject* D : Dead)
-    {
-        auto It = Objects.find(D);
-        if (It != Objects.end())
-        {
-            QObject* Obj = It->first;     
-            Objects.erase(It);         // remove from the list first
-            delete Obj;                   // then destroy memory
-        }
-    }
+    SweepDead(Dead);
 
     // perf logs
     const auto TSweep1 = Clock::now();
@@ -482,11 +1109,41 @@ double GarbageCollector::Collect(bool bSilent)
     const double MsSweep    = ms(TSweep1, TSweep0);
     const double MsTotal    = ms(TTotal1, TTotal0);
 
+    LastStats.ClearMs      = MsClear;
+    LastStats.MarkMs       = MsMark;
+    LastStats.BuildDeadMs  = MsBuild;
+    LastStats.FixupMs      = MsFixup;
+    LastStats.SweepMs      = MsSweep;
+    LastStats.TotalMs      = MsTotal;
+    LastStats.NumCollected = Dead.size();
+    LastStats.NumAlive     = Objects.size();
+    LastStats.NumPermanent = PermanentObjects.size();
+    LastStats.NumPendingKill = PendingKill.size();
+    LastStats.SafepointMs = Stop.TimeToSafepointMs;
+    LastStats.NumMutatorsStopped = Stop.NumMutators;
+    LastStats.ForkMs = 0.0;
+    LastStats.NumStackRoots = StackRoots.size();
+
     if (!bSilent)
     {
         std::cout << "[GC] Collected " << Dead.size()
                   << " objects, alive=" << Objects.size()
-                  << ". Total " << MsTotal << " ms.\n";
+                  << ", permanent=" << PermanentObjects.size();
+        if (!PendingKill.empty())
+        {
+            std::cout << ", pendingKill=" << PendingKill.size();
+        }
+        if (bConservativeStackScan)
+        {
+            std::cout << ", stackRoots=" << StackRoots.size();
+        }
+        std::cout << ". Total " << MsTotal << " ms.\n";
+
+        if (Stop.NumMutators > 0)
+        {
+            std::cout << "[GC] Safepoint - stopped " << Stop.NumMutators << " mutators in " << Stop.TimeToSafepointMs
+                      << " ms (slowest: " << Stop.SlowestMutator << ", " << Stop.SlowestMs << " ms)\n";
+        }
 
         std::cout << "[GC] Phase timings (ms) - "
                   << "clear="    << MsClear  << ", "
@@ -507,114 +1164,1169 @@ double GarbageCollector::Collect(bool bSilent)
                       << ", visited=" << visited << "\n";
         }
     }
+
+    if (AutoClusterAfter > 0)
+    {
+        AutoCluster();
+    }
+
+    if (bCompactAfterCollect)
+    {
+        bCompactPending = true;
+        bCompactPendingSilent = bSilent;
+    }
     
     return MsTotal;
 }
 
-void GarbageCollector::ListObjects() const
+double GarbageCollector::CollectRegion(QObject* Root, bool bSilent)
 {
-    // Group by reflected type name
-    struct Group { std::vector<const QObject*> Objs; };
-    std::unordered_map<std::string, Group> Groups;
-    Groups.reserve(Objects.size());
-
-    for (const auto& kv : Objects)
+    const char* FallbackReason = nullptr;
+    auto RegionIt = RegionByRoot.find(Root);
+    if (RegionIt == RegionByRoot.end())
     {
-        const QObject* Obj = kv.first;
-        const Node& Node   = kv.second;
-        const std::string& TypeName = Node.Ti ? Node.Ti->name : std::string("<UnknownType>");
-        Groups[TypeName].Objs.push_back(Obj);
+        FallbackReason = "does not own a region";
     }
-
-    // Order: by descending count, then by type name (stable, readable)
-    std::vector<std::pair<std::string, Group>> ordered;
-    ordered.reserve(Groups.size());
-    for (auto& kv : Groups) ordered.emplace_back(kv.first, std::move(kv.second));
-    std::sort(ordered.begin(), ordered.end(),
-        [](const auto& A, const auto& B)
+    else if (!IsRoot(Root))
+    {
+        FallbackReason = "is not a GC root";
+    }
+    else if (Regions[RegionIt->second].bHasIncomingRefs)
+    {
+        FallbackReason = "has cross-region references into its region";
+    }
+    else if (bRegionRefsDirty)
+    {
+        FallbackReason = "may have cross-region references written by a reflected call or load";
+    }
+    
+    if (FallbackReason)
+    {
+        if (!bSilent)
         {
-            if (A.second.Objs.size() != B.second.Objs.size())
-                return A.second.Objs.size() > B.second.Objs.size();
-            return A.first < B.first;
-        });
+            std::cout << "[GC] " << (Root ? Root->GetDebugName() : "(null)") << " " << FallbackReason
+                      << ", running a full collection.\n";
+        }
+        return Collect(bSilent);
+    }
+    
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](const Clock::time_point& a, const Clock::time_point& b)
+    {
+        return std::chrono::duration<double, std::milli>(a - b).count();
+    };
 
-    const size_t Total = Objects.size();
-    const size_t TypeCount = ordered.size();
+    FGcStopTheWorldScope StopScope;
+    const FGcStopStats& Stop = StopScope.GetStats();
 
-    std::cout << "[Objects] total=" << Total << ", types=" << TypeCount << std::endl;
+    const auto TTotal0 = Clock::now();
 
-    // Print up to this many names per type
-    constexpr size_t MaxSamples = 3;
+    std::vector<QObject*> Merged;
+    FlushRegistrationsInternal(&Merged);
 
-    for (const auto& [typeName, group] : ordered)
+    std::vector<QObject*> StackRoots;
+    if (bConservativeStackScan)
     {
-        // Deterministic sample order: by internal Id if available, else by pointer
-        std::vector<const QObject*> Samples = group.Objs;
-        std::sort(Samples.begin(), Samples.end(),
-            [this](const QObject* A, const QObject* B)
-            {
-                auto IterA = Objects.find(const_cast<QObject*>(A));
-                auto IterB = Objects.find(const_cast<QObject*>(B));
-                if (IterA != Objects.end() && IterB != Objects.end())
-                    return IterA->second.Id < IterB->second.Id;
-                return A < B;
-            });
+        GatherStackRoots(StackRoots);
+    }
 
-        // Build sample name list
-        std::ostringstream Names;
-        Names << "[";
-        size_t printed = 0;
-        for (const QObject* Obj : Samples)
+    const int32_t Index = RegionIt->second;
+    FRootRegion& Region = Regions[Index];
+
+    // 1) Clear marks
+    const auto TClear0 = Clock::now();
+    BeginMarkEpoch();
+    const auto TClear1 = Clock::now();
+
+    // 2) Mark. Tracing never leaves the region: references out of it are not followed, and nothing outside points
+    //    in except at the root. Clustered members are only judged by a full collection, so they act as roots here.
+    const auto TMark0 = Clock::now();
+    std::vector<std::pair<QObject*, Node*>> Stack;
+    
+    auto Visit = [&](QObject* Obj)
+    {
+        auto ObjIter = Objects.find(Obj);
+        if (ObjIter == Objects.end())
         {
-            if (printed == MaxSamples) break;
-            const std::string& Nm = Obj->GetDebugName();
-            if (printed) Names << ", ";
-            Names << (Nm.empty() ? "(Unnamed)" : Nm);
-            ++printed;
+            return;
         }
         
-        if (group.Objs.size() > MaxSamples)
+        Node& N = ObjIter->second;
+        if (N.RegionIndex != Index || N.MarkEpoch == CurrentEpoch)
         {
-            Names << ", ...";
+            return;
         }
         
-        Names << "]";
+        N.MarkEpoch = CurrentEpoch;
+        if (!N.Layout->bNoReferences && !Obj->IsGcIgnoredSelfAndBelow())
+        {
+            Stack.emplace_back(Obj, &N);
+        }
+    };
 
-        std::cout << " - " << typeName << " (count=" << group.Objs.size() << ") " << Names.str() << std::endl;
-    }
-}
+    auto ScanSlots = [&](QObject* Obj, const Node& N)
+    {
+        unsigned char* Base = BytePtr(Obj);
+        ForEachRawSlot(Base, *N.Layout, Visit);
+        for (size_t Offset : N.Layout->VecOffsets)
+        {
+            for (QObject* Child : *reinterpret_cast<const std::vector<QObject*>*>(Base + Offset))
+            {
+                if (Child) Visit(Child);
+            }
+        }
+    };
 
+    for (QObject* Member : Region.Members)
+    {
+        auto It = Objects.find(Member);
+        if (It != Objects.end() && (IsRoot(Member) || It->second.ClusterIndex >= 0))
+        {
+            Visit(Member);
+        }
+    }
 
-void GarbageCollector::ListPropertiesByDebugName(const std::string& Name) const
-{
-    QObject* Obj = FindByDebugName(Name);
-    if (!Obj)
+    for (QObject* Obj : StackRoots)
     {
-        std::cout << "Object [" << Name <<"] is not found." << "\n"; return;
+        Visit(Obj);
     }
-    
-    auto It = Objects.find(Obj);
-    const TypeInfo& Ti = *It->second.Ti;
-    
-    std::cout << "[Properties] " << Name << " : " << Ti.name << "\n";
-    Ti.ForEachProperty([&](const MetaProperty& p){
-        std::cout << " - " << p.type << " " << p.name << " (offset " << p.offset << ")\n";
-    });
-}
 
-void GarbageCollector::ListFunctionsByDebugName(const std::string& Name) const
-{
-    QObject* Obj = FindByDebugName(Name);
-    if (!Obj)
+    // Objects merged just now are unowned, but may hold the only reference to a member.
+    for (QObject* Obj : Merged)
     {
-        std::cout << "Object [" << Name <<"] is not found." << "\n"; return;
+        auto It = Objects.find(Obj);
+        if (It != Objects.end() && !It->second.Layout->bNoReferences)
+        {
+            ScanSlots(Obj, It->second);
+        }
     }
     
-    auto It = Objects.find(Obj);
-    const TypeInfo& Ti = *It->second.Ti;
+    while (!Stack.empty())
+    {
+        auto [Cur, N] = Stack.back();
+        Stack.pop_back();
+        ScanSlots(Cur, *N);
+    }
+    const auto TMark1 = Clock::now();
 
-    std::cout << "[Functions] " << Name << " : " << Ti.name << "\n";
-    Ti.ForEachFunction([&](const MetaFunction& Func){
+    // 3) Build a list of dead members
+    const auto TBuild0 = Clock::now();
+    std::vector<QObject*> Dead;
+    std::vector<std::pair<QObject*, const Node*>> Survivors;
+    Survivors.reserve(Region.Members.size());
+    for (QObject* Member : Region.Members)
+    {
+        auto It = Objects.find(Member);
+        if (It == Objects.end())
+        {
+            continue;
+        }
+        const Node& N = It->second;
+        if (N.MarkEpoch != CurrentEpoch)
+        {
+            Dead.push_back(Member);
+        }
+        else if (!N.Layout->bNoReferences)
+        {
+            Survivors.emplace_back(Member, &N);
+        }
+    }
+    const auto TBuild1 = Clock::now();
+
+    // 4) Fixup. Only members can point at dead members.
+    const auto TFix0 = Clock::now();
+    if (!Dead.empty())
+    {
+        const std::unordered_set<QObject*> DeadSet(Dead.begin(), Dead.end());
+        for (auto [Obj, N] : Survivors)
+        {
+            ClearDeadRefs(Obj, *N->Layout, DeadSet);
+        }
+    }
+    const auto TFix1 = Clock::now();
+
+    // 5) Sweep
+    const auto TSweep0 = Clock::now();
+    SweepDead(Dead);
+    const auto TSweep1 = Clock::now();
+    
+    const auto TTotal1 = Clock::now();
+
+    LastStats.ClearMs      = ms(TClear1, TClear0);
+    LastStats.MarkMs       = ms(TMark1, TMark0);
+    LastStats.BuildDeadMs  = ms(TBuild1, TBuild0);
+    LastStats.FixupMs      = ms(TFix1, TFix0);
+    LastStats.SweepMs      = ms(TSweep1, TSweep0);
+    LastStats.TotalMs      = ms(TTotal1, TTotal0);
+    LastStats.NumCollected = Dead.size();
+    LastStats.NumAlive     = Objects.size();
+    LastStats.NumPermanent = PermanentObjects.size();
+    LastStats.NumPendingKill = PendingKill.size();
+    LastStats.SafepointMs = Stop.TimeToSafepointMs;
+    LastStats.NumMutatorsStopped = Stop.NumMutators;
+    LastStats.ForkMs = 0.0;
+    LastStats.NumStackRoots = StackRoots.size();
+
+    if (!bSilent)
+    {
+        std::cout << "[GC] Region " << Root->GetDebugName() << ": collected " << Dead.size()
+                  << " objects, region alive=" << Region.Members.size()
+                  << ", heap alive=" << Objects.size() << ". Total " << LastStats.TotalMs << " ms.\n";
+        std::cout << "[GC] Phase timings (ms) - "
+                  << "clear="    << LastStats.ClearMs     << ", "
+                  << "mark="     << LastStats.MarkMs      << ", "
+                  << "buildDead="<< LastStats.BuildDeadMs << ", "
+                  << "fixup="    << LastStats.FixupMs     << ", "
+                  << "sweep="    << LastStats.SweepMs     << "\n";
+    }
+    
+    return LastStats.TotalMs;
+}
+
+bool GarbageCollector::SetConservativeStackScan(bool bEnable)
+{
+#if !defined(__linux__)
+    if (bEnable)
+    {
+        return false;
+    }
+#endif
+    
+    bConservativeStackScan = bEnable;
+    return true;
+}
+
+void GarbageCollector::GatherStackRoots(std::vector<QObject*>& Out)
+{
+    std::unordered_set<QObject*> Found;
+    std::lock_guard<std::mutex> Lock(AllocatorMutex);
+    
+    GcVisitThreadStacks([&](const void* Low, const void* High)
+    {
+        const uintptr_t Begin = (reinterpret_cast<uintptr_t>(Low) + alignof(void*) - 1) & ~(uintptr_t(alignof(void*)) - 1);
+        const uintptr_t End = reinterpret_cast<uintptr_t>(High);
+        for (uintptr_t Word = Begin; Word + sizeof(void*) <= End; Word += sizeof(void*))
+        {
+            // Objects start on a Granularity boundary (slab slots and system allocations alike).
+            QObject* Candidate = *reinterpret_cast<QObject* const*>(Word);
+            if (!Candidate || (reinterpret_cast<uintptr_t>(Candidate) & (FObjectAllocator::Granularity - 1)) != 0
+                || Found.contains(Candidate))
+            {
+                continue;
+            }
+
+            // Slab addresses answer from the page map and live bits; anything else must be a registered large object.
+            const bool bManaged = Allocator.OwnsAddress(Candidate)
+                ? Allocator.IsLiveObject(Candidate)
+                : (Objects.contains(Candidate) || PermanentObjects.contains(Candidate));
+            if (bManaged)
+            {
+                Found.insert(Candidate);
+            }
+        }
+    });
+    
+    Out.insert(Out.end(), Found.begin(), Found.end());
+}
+
+bool GarbageCollector::SetMode(EGcMode NewMode)
+{
+#if !defined(__linux__)
+    if (NewMode == EGcMode::Fork)
+    {
+        return false;
+    }
+#endif
+
+    if (NewMode == EGcMode::StopTheWorld && ForkCollect.Pid > 0)
+    {
+        FinishForkCollect(true);
+    }
+    Mode = NewMode;
+    return true;
+}
+
+double GarbageCollector::BeginForkCollect(bool bSilent)
+{
+#if defined(__linux__)
+    if (ForkCollect.Pid > 0)
+    {
+        if (!bSilent)
+        {
+            std::cout << "[GC] Fork collection still running (pid " << ForkCollect.Pid << "), skipped.\n";
+        }
+        return 0.0;
+    }
+    
+    using Clock = std::chrono::high_resolution_clock;
+    
+    int Fds[2];
+    if (pipe(Fds) != 0)
+    {
+        std::cout << "[GC] pipe() failed, collection skipped.\n";
+        return 0.0;
+    }
+
+    // The world stays stopped only while forking, so the child copies a heap no mutator is halfway through editing.
+    FGcStopTheWorldScope StopScope;
+    const auto T0 = Clock::now();
+
+    // Merged objects are in Objects before the fork and traced as roots by the child, as in Collect(). Stacks are
+    // scanned here: the child only has the forking thread.
+    std::vector<QObject*> Merged;
+    FlushRegistrationsInternal(&Merged);
+
+    std::vector<QObject*> StackRoots;
+    if (bConservativeStackScan)
+    {
+        GatherStackRoots(StackRoots);
+    }
+
+    const pid_t Pid = fork();
+    if (Pid == 0)
+    {
+        // Child: only this thread exists, so mark sequentially. Exit without running destructors or atexit handlers.
+        close(Fds[0]);
+        
+        const auto TMark0 = Clock::now();
+        BeginMarkEpoch();
+        Mark();
+        for (QObject* Obj : Merged)
+        {
+            MarkFromRoot(Obj);
+        }
+        for (QObject* Obj : StackRoots)
+        {
+            MarkFromRoot(Obj);
+        }
+        const double MarkMs = std::chrono::duration<double, std::milli>(Clock::now() - TMark0).count();
+
+        // Wire format: mark time, then one FForkDeadEntry per unmarked object.
+        std::vector<unsigned char> Out(sizeof(double));
+        std::memcpy(Out.data(), &MarkMs, sizeof(double));
+        for (const auto& [Obj, N] : Objects)
+        {
+            if (!IsMarked(N))
+            {
+                const FForkDeadEntry Entry{Obj, N.Id};
+                const auto* Bytes = reinterpret_cast<const unsigned char*>(&Entry);
+                Out.insert(Out.end(), Bytes, Bytes + sizeof(Entry));
+            }
+        }
+
+        size_t Written = 0;
+        while (Written < Out.size())
+        {
+            const ssize_t N = write(Fds[1], Out.data() + Written, Out.size() - Written);
+            if (N < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (N <= 0)
+            {
+                _exit(1);
+            }
+            Written += static_cast<size_t>(N);
+        }
+        _exit(0);
+    }
+
+    close(Fds[1]);
+    const double ForkMs = std::chrono::duration<double, std::milli>(Clock::now() - T0).count();
+    
+    if (Pid < 0)
+    {
+        close(Fds[0]);
+        std::cout << "[GC] fork() failed, collection skipped.\n";
+        return 0.0;
+    }
+
+    fcntl(Fds[0], F_SETFL, fcntl(Fds[0], F_GETFL) | O_NONBLOCK);
+    
+    ForkCollect = FForkCollect();
+    ForkCollect.Pid = Pid;
+    ForkCollect.ReadFd = Fds[0];
+    ForkCollect.bSilent = bSilent;
+    ForkCollect.ForkMs = ForkMs;
+    ForkCollect.NumStackRoots = StackRoots.size();
+
+    if (!bSilent)
+    {
+        std::cout << "[GC] Forked marker (pid " << Pid << ") in " << ForkMs << " ms.\n";
+    }
+    return ForkMs;
+#else
+    (void)bSilent;
+    return 0.0;
+#endif
+}
+
+bool GarbageCollector::FinishForkCollect(bool bWait)
+{
+#if defined(__linux__)
+    if (ForkCollect.Pid <= 0)
+    {
+        return false;
+    }
+
+    unsigned char Chunk[64 * 1024];
+    bool bFailed = false;
+    for (;;)
+    {
+        const ssize_t N = read(ForkCollect.ReadFd, Chunk, sizeof(Chunk));
+        if (N > 0)
+        {
+            ForkCollect.Received.insert(ForkCollect.Received.end(), Chunk, Chunk + N);
+            continue;
+        }
+        if (N == 0)
+        {
+            break; // child closed the pipe
+        }
+        if (errno == EINTR)
+        {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            if (!bWait)
+            {
+                return false;
+            }
+            pollfd Poll{ForkCollect.ReadFd, POLLIN, 0};
+            poll(&Poll, 1, -1);
+            continue;
+        }
+        bFailed = true;
+        break;
+    }
+
+    close(ForkCollect.ReadFd);
+    int Status = 0;
+    while (waitpid(ForkCollect.Pid, &Status, 0) < 0 && errno == EINTR)
+    {
+    }
+
+    const FForkCollect Result = std::move(ForkCollect);
+    ForkCollect = FForkCollect();
+
+    const size_t PayloadSize = Result.Received.size() - std::min(Result.Received.size(), sizeof(double));
+    if (bFailed || !WIFEXITED(Status) || WEXITSTATUS(Status) != 0 || Result.Received.size() < sizeof(double)
+        || PayloadSize % sizeof(FForkDeadEntry) != 0)
+    {
+        std::cout << "[GC] Fork marker failed, result discarded.\n";
+        return true;
+    }
+    if (Result.bInvalidated)
+    {
+        if (!Result.bSilent)
+        {
+            std::cout << "[GC] Roots or references changed while the fork marker ran, result discarded.\n";
+        }
+        return true;
+    }
+
+    SweepForkResult(Result);
+    return true;
+#else
+    (void)bWait;
+    return false;
+#endif
+}
+
+void GarbageCollector::SweepForkResult(const FForkCollect& Result)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](const Clock::time_point& a, const Clock::time_point& b)
+    {
+        return std::chrono::duration<double, std::milli>(a - b).count();
+    };
+
+    FGcStopTheWorldScope StopScope;
+    const FGcStopStats& Stop = StopScope.GetStats();
+
+    const auto TTotal0 = Clock::now();
+
+    double MarkMs = 0.0;
+    std::memcpy(&MarkMs, Result.Received.data(), sizeof(double));
+
+    // 1) Dead list. Entries swept or relocated since the fork no longer match a live node with the same id.
+    const auto TBuild0 = Clock::now();
+    const size_t NumEntries = (Result.Received.size() - sizeof(double)) / sizeof(FForkDeadEntry);
+    std::vector<QObject*> Dead;
+    Dead.reserve(NumEntries);
+    for (size_t i = 0; i < NumEntries; ++i)
+    {
+        FForkDeadEntry Entry;
+        std::memcpy(&Entry, Result.Received.data() + sizeof(double) + i * sizeof(FForkDeadEntry), sizeof(Entry));
+        
+        // A root never dies, whatever the snapshot said: sweeping it would leave a freed pointer in Roots.
+        auto It = Objects.find(Entry.Obj);
+        if (It != Objects.end() && It->second.Id == Entry.Id && !RootSlots.contains(Entry.Obj))
+        {
+            Dead.push_back(Entry.Obj);
+        }
+    }
+    
+    std::unordered_set<QObject*> DeadSet(Dead.begin(), Dead.end());
+    for (auto& [Obj, Node] : Objects)
+    {
+        if (Node.SurvivedCount < UINT16_MAX && !DeadSet.contains(Obj))
+        {
+            ++Node.SurvivedCount;
+        }
+    }
+    const auto TBuild1 = Clock::now();
+
+    // 2) Fixup
+    const auto TFix0 = Clock::now();
+    FixupSurvivors(DeadSet, [&](QObject* Obj, const Node&) { return !DeadSet.contains(Obj); });
+    const auto TFix1 = Clock::now();
+
+    // 3) Sweep
+    const auto TSweep0 = Clock::now();
+    SweepDead(Dead);
+    const auto TSweep1 = Clock::now();
+
+    const auto TTotal1 = Clock::now();
+
+    LastStats.ClearMs      = 0.0;
+    LastStats.MarkMs       = MarkMs;
+    LastStats.BuildDeadMs  = ms(TBuild1, TBuild0);
+    LastStats.FixupMs      = ms(TFix1, TFix0);
+    LastStats.SweepMs      = ms(TSweep1, TSweep0);
+    LastStats.TotalMs      = ms(TTotal1, TTotal0);
+    LastStats.NumCollected = Dead.size();
+    LastStats.NumAlive     = Objects.size();
+    LastStats.NumPermanent = PermanentObjects.size();
+    LastStats.NumPendingKill = PendingKill.size();
+    LastStats.SafepointMs = Stop.TimeToSafepointMs;
+    LastStats.NumMutatorsStopped = Stop.NumMutators;
+    LastStats.ForkMs = Result.ForkMs;
+    LastStats.NumStackRoots = Result.NumStackRoots;
+
+    if (!Result.bSilent)
+    {
+        std::cout << "[GC] Fork collected " << Dead.size() << " objects, alive=" << Objects.size()
+                  << ". Pause " << LastStats.TotalMs << " ms (fork " << Result.ForkMs << " ms, child mark "
+                  << MarkMs << " ms).\n";
+        std::cout << "[GC] Phase timings (ms) - "
+                  << "buildDead="<< LastStats.BuildDeadMs << ", "
+                  << "fixup="    << LastStats.FixupMs     << ", "
+                  << "sweep="    << LastStats.SweepMs     << "\n";
+    }
+
+    if (AutoClusterAfter > 0)
+    {
+        AutoCluster();
+    }
+
+    if (bCompactAfterCollect)
+    {
+        bCompactPending = true;
+        bCompactPendingSilent = Result.bSilent;
+    }
+}
+
+size_t GarbageCollector::Compact(bool bSilent)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    const auto T0 = Clock::now();
+    
+    FGcStopTheWorldScope StopScope;
+    bCompactPending = false;
+
+    // Objects still in registration buffers are not in Objects, so their slots would never be rewritten.
+    FlushRegistrationsInternal(nullptr);
+
+    // Stack words cannot be rewritten, so objects they point at stay in place.
+    std::vector<QObject*> StackRoots;
+    if (bConservativeStackScan)
+    {
+        GatherStackRoots(StackRoots);
+    }
+    const std::unordered_set<QObject*> StackPinned(StackRoots.begin(), StackRoots.end());
+    
+    // Held for the whole pass: slots freed while moving must not be handed to another thread before the
+    // references to them are rewritten.
+    std::lock_guard<std::mutex> AllocatorLock(AllocatorMutex);
+    const size_t PagesBefore = Allocator.GetStats().NumPages - Allocator.GetStats().NumEmptyPages;
+
+    // 1) Reachability (DFS pre-order) from roots, keeping only objects that may move.
+    std::vector<QObject*> Order;
+    Order.reserve(Objects.size());
+    
+    std::unordered_set<QObject*> Seen;
+    Seen.reserve(Objects.size() * 2 + 1);
+    
+    std::vector<QObject*> Stack;
+    std::vector<QObject*> Children;
+    
+    auto Push = [&](QObject* Obj)
+    {
+        if (Obj && Seen.insert(Obj).second)
+        {
+            Stack.push_back(Obj);
+        }
+    };
+    
+    for (QObject* Root : Roots) Push(Root);
+    for (QObject* Source : PermanentRootSources) Push(Source);
+
+    size_t NumPinned = 0;
+    while (!Stack.empty())
+    {
+        QObject* Cur = Stack.back();
+        Stack.pop_back();
+
+        const Node* N = FindNode(Cur);
+        if (!N)
+        {
+            continue;
+        }
+
+        if (Objects.contains(Cur) && !IsRoot(Cur))
+        {
+            if (N->Ti->relocate && !StackPinned.contains(Cur) && N->Ti->size <= FObjectAllocator::MaxSlabSize && Allocator.OwnsAddress(Cur))
+            {
+                Order.push_back(Cur);
+            }
+            else
+            {
+                ++NumPinned;
+            }
+        }
+
+        if (N->Layout->bNoReferences || Cur->IsGcIgnoredSelfAndBelow())
+        {
+            continue;
+        }
+
+        // Push children in reverse so they pop in declaration order.
+        Children.clear();
+        unsigned char* Base = BytePtr(Cur);
+        ForEachRawSlot(Base, *N->Layout, [&](QObject* Child) { Children.push_back(Child); });
+        for (size_t Offset : N->Layout->VecOffsets)
+        {
+            const auto* Vec = reinterpret_cast<const std::vector<QObject*>*>(Base + Offset);
+            Children.insert(Children.end(), Vec->begin(), Vec->end());
+        }
+        for (auto It = Children.rbegin(); It != Children.rend(); ++It)
+        {
+            Push(*It);
+        }
+    }
+
+    // 2) Move. Old slots stay allocated until every reference has been rewritten: a source page that emptied
+    //    mid-pass could otherwise be taken back as a compaction target, and a moved object would land on an
+    //    address that is still a key in Relocated.
+    std::unordered_map<QObject*, QObject*> Relocated;
+    Relocated.reserve(Order.size() * 2 + 1);
+    std::vector<std::pair<QObject*, size_t>> Vacated;
+    Vacated.reserve(Order.size());
+    
+    for (QObject* Obj : Order)
+    {
+        auto It = Objects.find(Obj);
+        const Node N = It->second;
+        Objects.erase(It);
+
+        void* Dst = Allocator.AllocateCompact(N.Ti->size);
+        N.Ti->relocate(Dst, Obj);
+        Allocator.SetLive(Obj, false);
+        Allocator.SetLive(Dst, true);
+        Vacated.emplace_back(Obj, N.Ti->size);
+
+        QObject* Moved = static_cast<QObject*>(Dst);
+        Objects.emplace(Moved, N);
+        SetIdSlot(N.Id, Moved);
+        InstancesByType[N.Ti->type_index][N.TypeSlot] = Moved;
+        Relocated.emplace(Obj, Moved);
+
+        if (N.RegionIndex >= 0)
+        {
+            Regions[N.RegionIndex].Members.erase(Obj);
+            Regions[N.RegionIndex].Members.insert(Moved);
+        }
+        if (auto RootIt = RegionByRoot.find(Obj); RootIt != RegionByRoot.end())
+        {
+            const int32_t Index = RootIt->second;
+            RegionByRoot.erase(RootIt);
+            RegionByRoot.emplace(Moved, Index);
+            Regions[Index].Root = Moved;
+        }
+    }
+    Allocator.EndCompaction();
+
+    // 3) Rewrite reflected references everywhere (moved objects, stationary objects and the permanent region).
+    auto Remap = [&](QObject*& Slot)
+    {
+        if (auto It = Relocated.find(Slot); It != Relocated.end())
+        {
+            Slot = It->second;
+        }
+    };
+    
+    auto RewriteSlots = [&](QObject* Obj, const Node& N)
+    {
+        if (N.Layout->bNoReferences)
+        {
+            return;
+        }
+        
+        unsigned char* Base = BytePtr(Obj);
+        ForEachRawSlot(Base, *N.Layout, Remap);
+        for (size_t Offset : N.Layout->VecOffsets)
+        {
+            auto* Vec = reinterpret_cast<std::vector<QObject*>*>(Base + Offset);
+            for (QObject*& Child : *Vec)
+            {
+                if (Child) Remap(Child);
+            }
+        }
+    };
+
+    if (!Relocated.empty())
+    {
+        for (auto& [Obj, N] : Objects) RewriteSlots(Obj, N);
+        for (auto& [Obj, N] : PermanentObjects) RewriteSlots(Obj, N);
+
+        for (FGcCluster& Cluster : Clusters)
+        {
+            if (!Cluster.Root) continue;
+            Remap(Cluster.Root);
+            for (QObject*& Member : Cluster.Members) Remap(Member);
+            for (QObject*& Ext : Cluster.ExternalRefs) Remap(Ext);
+        }
+
+        for (auto& [Obj, N] : Objects) Obj->PostGcCompact(Relocated);
+        for (auto& [Obj, N] : PermanentObjects) Obj->PostGcCompact(Relocated);
+    }
+
+    // 4) Release the source slots; pages left empty are decommitted for reuse.
+    for (const auto& [Old, Size] : Vacated)
+    {
+        Allocator.Free(Old, Size);
+    }
+
+    const double Ms = std::chrono::duration<double, std::milli>(Clock::now() - T0).count();
+    const size_t PagesAfter = Allocator.GetStats().NumPages - Allocator.GetStats().NumEmptyPages;
+    
+    if (!bSilent)
+    {
+        std::cout << "[GC] Compacted " << Relocated.size() << " objects (" << NumPinned << " pinned) in " << Ms
+                  << " ms. Committed pages " << PagesBefore << " -> " << PagesAfter << ".\n";
+    }
+    
+    return Relocated.size();
+}
+
+void* GarbageCollector::AllocateObjectMemory(const TypeInfo& Ti)
+{
+    std::lock_guard<std::mutex> Lock(AllocatorMutex);
+    if (Ti.size <= FObjectAllocator::MaxSlabSize)
+    {
+        return Allocator.Allocate(Ti.size);
+    }
+    
+    FObjectPool& Pool = Pools[&Ti];
+    if (!Pool.Free.empty())
+    {
+        void* Mem = Pool.Free.back();
+        Pool.Free.pop_back();
+        ++Pool.Hits;
+        return Mem;
+    }
+
+    ++Pool.Misses;
+    return Allocator.Allocate(Ti.size);
+}
+
+void GarbageCollector::FreeObjectMemory(const TypeInfo& Ti, void* Mem)
+{
+    // Slab slots are recycled by the slab's own per-size-class bitmaps. Holding them in the pool would scatter
+    // retained blocks over every page and keep empty pages from being decommitted.
+    std::lock_guard<std::mutex> Lock(AllocatorMutex);
+    if (Allocator.OwnsAddress(Mem))
+    {
+        Allocator.Free(Mem, Ti.size);
+        return;
+    }
+    
+    FObjectPool& Pool = Pools[&Ti];
+    if (Pool.Free.size() < PoolCapPerType)
+    {
+        Pool.Free.push_back(Mem);
+        return;
+    }
+    Allocator.Free(Mem, Ti.size);
+}
+
+void GarbageCollector::DestroyObject(QObject* Obj, const TypeInfo& Ti)
+{
+    // The live bit is cleared by the sweep (or by Free for slab storage).
+    Obj->FinishDestroy();
+    Obj->~QObject();
+    FreeObjectMemory(Ti, Obj);
+}
+
+void GarbageCollector::SetPoolCap(size_t BlocksPerType)
+{
+    PoolCapPerType = BlocksPerType;
+    TrimPools(PoolCapPerType);
+}
+
+size_t GarbageCollector::TrimPools(size_t KeepPerType)
+{
+    std::lock_guard<std::mutex> Lock(AllocatorMutex);
+    for (auto& [Ti, Pool] : Pools)
+    {
+        while (Pool.Free.size() > KeepPerType)
+        {
+            Allocator.Free(Pool.Free.back(), Ti->size);
+            Pool.Free.pop_back();
+        }
+        if (Pool.Free.empty())
+        {
+            Pool.Free.shrink_to_fit();
+        }
+    }
+    return Allocator.ReleaseEmptyPages();
+}
+
+void GarbageCollector::ListPools() const
+{
+    size_t TotalBytes = 0;
+    std::lock_guard<std::mutex> Lock(AllocatorMutex);
+    std::cout << "[Pools] cap/type=" << PoolCapPerType << ", types=" << Pools.size() << "\n";
+    for (const auto& [Ti, Pool] : Pools)
+    {
+        const size_t Bytes = Pool.Free.size() * Ti->size;
+        TotalBytes += Bytes;
+        std::cout << " - " << Ti->name << " (size=" << Ti->size << ") free=" << Pool.Free.size()
+                  << " hits=" << Pool.Hits << " misses=" << Pool.Misses << " retained=" << Bytes << "B\n";
+    }
+    std::cout << "[Pools] retained total=" << TotalBytes << "B\n";
+    Allocator.PrintStats();
+}
+
+size_t GarbageCollector::CreateCluster(QObject* Root)
+{
+    return CreateClusterInternal(Root, 0);
+}
+
+size_t GarbageCollector::CreateClusterInternal(QObject* Root, uint16_t MinSurvived)
+{
+    // A permanent object can root a cluster but is never a member: it is not in Objects and never dies.
+    const Node* RootNode = FindNode(Root);
+    if (!RootNode || FindClusterIndex(Root) >= 0 || Root->IsGcIgnoredSelfAndBelow())
+    {
+        return 0;
+    }
+    const bool bPermanentRoot = IsPermanent(Root);
+
+    FGcCluster Cluster;
+    Cluster.Root = Root;
+    if (!bPermanentRoot)
+    {
+        Cluster.Members.push_back(Root);
+    }
+
+    std::unordered_set<QObject*> Seen;
+    Seen.insert(Root);
+
+    std::vector<std::pair<QObject*, const Node*>> Stack;
+    Stack.emplace_back(Root, RootNode);
+
+    // Members: reachable, not a GC root, not clustered elsewhere, old enough. Anything else is an external ref.
+    auto Consider = [&](QObject* Child)
+    {
+        if (!Seen.insert(Child).second)
+        {
+            return;
+        }
+        
+        auto It = Objects.find(Child);
+        if (It == Objects.end())
+        {
+            return;
+        }
+
+        const Node& N = It->second;
+        if (IsRoot(Child) || N.ClusterIndex >= 0 || N.SurvivedCount < MinSurvived)
+        {
+            Cluster.ExternalRefs.push_back(Child);
+            return;
+        }
+
+        Cluster.Members.push_back(Child);
+        
+        // Ignored subtrees are not traced by Mark, so they are not pulled in here either.
+        if (!N.Layout->bNoReferences && !Child->IsGcIgnoredSelfAndBelow())
+        {
+            Stack.emplace_back(Child, &N);
+        }
+    };
+
+    while (!Stack.empty())
+    {
+        auto [Cur, N] = Stack.back();
+        Stack.pop_back();
+
+        unsigned char* Base = BytePtr(Cur);
+        ForEachRawSlot(Base, *N->Layout, Consider);
+        
+        for (size_t Offset : N->Layout->VecOffsets)
+        {
+            const auto* Vec = reinterpret_cast<const std::vector<QObject*>*>(Base + Offset);
+            for (QObject* Child : *Vec)
+            {
+                if (Child)
+                {
+                    Consider(Child);
+                }
+            }
+        }
+    }
+
+    // Nothing but the root: no point in a cluster.
+    if (Cluster.Members.size() < (bPermanentRoot ? 1u : 2u))
+    {
+        return 0;
+    }
+
+    Cluster.MarkEpoch = bPermanentRoot ? CurrentEpoch : RootNode->MarkEpoch;
+
+    int32_t Index;
+    if (!FreeClusterIndices.empty())
+    {
+        Index = FreeClusterIndices.back();
+        FreeClusterIndices.pop_back();
+    }
+    else
+    {
+        Index = static_cast<int32_t>(Clusters.size());
+        Clusters.emplace_back();
+    }
+
+    for (QObject* Member : Cluster.Members)
+    {
+        Objects.find(Member)->second.ClusterIndex = Index;
+    }
+
+    const size_t NumMembers = Cluster.Members.size();
+    Clusters[Index] = std::move(Cluster);
+    return NumMembers;
+}
+
+bool GarbageCollector::DissolveCluster(QObject* Root)
+{
+    const int32_t Index = FindClusterIndex(Root);
+    if (Index < 0)
+    {
+        return false;
+    }
+
+    const FGcCluster& Cluster = Clusters[Index];
+    for (QObject* Member : Cluster.Members)
+    {
+        // Hand the shared mark back to each member so the current epoch stays consistent.
+        Node& N = Objects.find(Member)->second;
+        N.ClusterIndex = -1;
+        N.MarkEpoch = Cluster.MarkEpoch;
+    }
+
+    ReleaseCluster(Index);
+    return true;
+}
+
+void GarbageCollector::DissolveAllClusters()
+{
+    for (auto& [Obj, Node] : Objects)
+    {
+        if (Node.ClusterIndex >= 0)
+        {
+            Node.MarkEpoch = Clusters[Node.ClusterIndex].MarkEpoch;
+            Node.ClusterIndex = -1;
+        }
+    }
+    
+    Clusters.clear();
+    FreeClusterIndices.clear();
+}
+
+void GarbageCollector::DissolveClusterOf(QObject* Obj)
+{
+    const int32_t Index = FindClusterIndex(Obj);
+    if (Index >= 0)
+    {
+        DissolveCluster(Clusters[Index].Root);
+    }
+}
+
+bool GarbageCollector::IsInCluster(const QObject* Obj) const
+{
+    return FindClusterIndex(Obj) >= 0;
+}
+
+int32_t GarbageCollector::FindClusterIndex(const QObject* Obj) const
+{
+    if (auto It = Objects.find(const_cast<QObject*>(Obj)); It != Objects.end())
+    {
+        return It->second.ClusterIndex;
+    }
+
+    // Permanent roots are not tagged, search the cluster list.
+    for (size_t i = 0; i < Clusters.size(); ++i)
+    {
+        if (Clusters[i].Root == Obj)
+        {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+void GarbageCollector::ReleaseCluster(int32_t Index)
+{
+    Clusters[Index] = FGcCluster();
+    FreeClusterIndices.push_back(Index);
+}
+
+void GarbageCollector::AutoCluster()
+{
+    const uint16_t MinSurvived = static_cast<uint16_t>(std::min<uint32_t>(AutoClusterAfter, UINT16_MAX));
+    
+    for (QObject* Root : Roots)
+    {
+        // Permanent roots have no survival count; they always qualify.
+        auto It = Objects.find(Root);
+        if (It != Objects.end() && It->second.SurvivedCount < MinSurvived)
+        {
+            continue;
+        }
+        if (FindClusterIndex(Root) >= 0)
+        {
+            continue;
+        }
+
+        CreateClusterInternal(Root, MinSurvived);
+    }
+}
+
+void GarbageCollector::ListObjects() const
+{
+    // Group by reflected type name
+    struct Group { std::vector<const QObject*> Objs; bool bLeaf = false; size_t NumPermanent = 0; };
+    std::unordered_map<std::string, Group> Groups;
+    Groups.reserve(Objects.size());
+
+    auto AddToGroup = [&](const QObject* Obj, const Node& Node, bool bPermanent)
+    {
+        const std::string& TypeName = Node.Ti ? Node.Ti->name : std::string("<UnknownType>");
+        Group& G = Groups[TypeName];
+        G.Objs.push_back(Obj);
+        G.bLeaf = Node.Layout && Node.Layout->bNoReferences;
+        G.NumPermanent += bPermanent ? 1 : 0;
+    };
+    
+    for (const auto& [Obj, Node] : Objects)
+    {
+        AddToGroup(Obj, Node, false);
+    }
+    for (const auto& [Obj, Node] : PermanentObjects)
+    {
+        AddToGroup(Obj, Node, true);
+    }
+
+    // Order: by descending count, then by type name (stable, readable)
+    std::vector<std::pair<std::string, Group>> ordered;
+    ordered.reserve(Groups.size());
+    for (auto& kv : Groups) ordered.emplace_back(kv.first, std::move(kv.second));
+    std::sort(ordered.begin(), ordered.end(),
+        [](const auto& A, const auto& B)
+        {
+            if (A.second.Objs.size() != B.second.Objs.size())
+                return A.second.Objs.size() > B.second.Objs.size();
+            return A.first < B.first;
+        });
+
+    const size_t Total = Objects.size() + PermanentObjects.size();
+    const size_t TypeCount = ordered.size();
+
+    std::cout << "[Objects] total=" << Total << ", types=" << TypeCount << ", permanent=" << PermanentObjects.size() << ", clusters=" << GetNumClusters() << std::endl;
+
+    // Print up to this many names per type
+    constexpr size_t MaxSamples = 3;
+
+    for (const auto& [typeName, group] : ordered)
+    {
+        // Deterministic sample order: by internal Id if available, else by pointer
+        std::vector<const QObject*> Samples = group.Objs;
+        std::sort(Samples.begin(), Samples.end(),
+            [this](const QObject* A, const QObject* B)
+            {
+                const Node* NodeA = FindNode(A);
+                const Node* NodeB = FindNode(B);
+                if (NodeA && NodeB)
+                    return NodeA->Id < NodeB->Id;
+                return A < B;
+            });
+
+        // Build sample name list
+        std::ostringstream Names;
+        Names << "[";
+        size_t printed = 0;
+        for (const QObject* Obj : Samples)
+        {
+            if (printed == MaxSamples) break;
+            const std::string& Nm = Obj->GetDebugName();
+            if (printed) Names << ", ";
+            Names << (Nm.empty() ? "(Unnamed)" : Nm);
+            ++printed;
+        }
+        
+        if (group.Objs.size() > MaxSamples)
+        {
+            Names << ", ...";
+        }
+        
+        Names << "]";
+
+        std::cout << " - " << typeName << " (count=" << group.Objs.size() << (group.bLeaf ? ", leaf" : "")
+                  << (group.NumPermanent ? ", permanent=" + std::to_string(group.NumPermanent) : std::string()) << ") " << Names.str() << std::endl;
+    }
+}
+
+
+void GarbageCollector::ListPropertiesByDebugName(const std::string& Name) const
+{
+    QObject* Obj = FindByDebugName(Name);
+    if (!Obj)
+    {
+        std::cout << "Object [" << Name <<"] is not found." << "\n"; return;
+    }
+    
+    const TypeInfo& Ti = *FindNode(Obj)->Ti;
+    
+    std::cout << "[Properties] " << Name << " : " << Ti.name << "\n";
+    Ti.ForEachProperty([&](const MetaProperty& p){
+        std::cout << " - " << p.type << " " << p.name << " (offset " << p.offset << ")\n";
+    });
+}
+
+void GarbageCollector::ListFunctionsByDebugName(const std::string& Name) const
+{
+    QObject* Obj = FindByDebugName(Name);
+    if (!Obj)
+    {
+        std::cout << "Object [" << Name <<"] is not found." << "\n"; return;
+    }
+    
+    const TypeInfo& Ti = *FindNode(Obj)->Ti;
+
+    std::cout << "[Functions] " << Name << " : " << Ti.name << "\n";
+    Ti.ForEachFunction([&](const MetaFunction& Func){
         std::cout << " - " << Func.return_type << " " << Func.name << "(";
         for (size_t i = 0; i < Func.params.size(); ++i) {
             if (i) std::cout << ", ";
@@ -624,26 +2336,170 @@ void GarbageCollector::ListFunctionsByDebugName(const std::string& Name) const
     });
 }
 
-void GarbageCollector::SetAllowTraverseParents(bool bEnable)
+void GarbageCollector::SetAllowTraverseParents(bool bEnable)
+{
+    bAllowTraverseParents = bEnable;
+}
+
+bool GarbageCollector::GetAllowTraverseParents() const
+{
+    return bAllowTraverseParents;
+}
+
+QObject* GarbageCollector::FindByDebugName(const std::string& DebugName) const
+{
+    // Find() does not intern, so lookups of unknown names leave the name table untouched.
+    const FName Name = FName::Find(DebugName);
+    if (Name.IsNone())
+    {
+        return nullptr;
+    }
+
+    if (const uint64_t Id = QObjectBase::FindIdByExplicitName(Name))
+    {
+        return FindById(Id);
+    }
+    
+    // Generated names carry the id as number suffix ("QActor_12"); the type part must match as well.
+    if (Name.GetNumber() == 0)
+    {
+        return nullptr;
+    }
+    QObject* Obj = FindById(Name.GetNumber() - 1);
+    return (Obj && Obj->GetDebugFName() == Name) ? Obj : nullptr;
+}
+
+QObject* GarbageCollector::FindByNameOrId(const std::string& Token) const
 {
-    bAllowTraverseParents = bEnable;
+    if (Token.size() > 1 && Token[0] == '#')
+    {
+        uint64_t Id = 0;
+        const char* End = Token.data() + Token.size();
+        const auto [Ptr, Ec] = std::from_chars(Token.data() + 1, End, Id);
+        return (Ec == std::errc() && Ptr == End) ? FindById(Id) : nullptr;
+    }
+    return FindByDebugName(Token);
 }
 
-bool GarbageCollector::GetAllowTraverseParents() const
+size_t GarbageCollector::FindReferencesTo(const std::function<bool(const QObject*)>& IsTarget,
+                                          const std::function<void(const QObject*, const QObject*)>& OnRef) const
 {
-    return bAllowTraverseParents;
+    size_t Found = 0;
+    auto Scan = [&](const std::unordered_map<QObject*, Node>& Map)
+    {
+        for (const auto& [Obj, N] : Map)
+        {
+            if (!N.Layout || N.Layout->bNoReferences)
+            {
+                continue;
+            }
+            
+            unsigned char* Base = BytePtr(Obj);
+            auto Check = [&](QObject* Target)
+            {
+                if (Target && IsTarget(Target))
+                {
+                    OnRef(Obj, Target);
+                    ++Found;
+                }
+            };
+            
+            ForEachRawSlot(Base, *N.Layout, Check);
+            for (size_t Offset : N.Layout->VecOffsets)
+            {
+                for (QObject* Target : *reinterpret_cast<std::vector<QObject*>*>(Base + Offset))
+                {
+                    Check(Target);
+                }
+            }
+        }
+    };
+    
+    Scan(Objects);
+    Scan(PermanentObjects);
+    return Found;
 }
 
-QObject* GarbageCollector::FindByDebugName(const std::string& DebugName) const
+const TypeInfo* GarbageCollector::GetTypeInfo(const QObject* Obj) const
+{
+    if (const Node* N = FindNode(Obj))
+    {
+        return N->Ti;
+    }
+    
+    // Not merged yet: only the creating thread can see it.
+    if (!IsGameThread())
+    {
+        FRegistrationBuffer& Buffer = const_cast<GarbageCollector*>(this)->GetThreadRegistrationBuffer();
+        std::lock_guard<std::mutex> Lock(Buffer.Mutex);
+        if (auto It = Buffer.Items.find(const_cast<QObject*>(Obj)); It != Buffer.Items.end())
+        {
+            return It->second.Ti;
+        }
+    }
+    return nullptr;
+}
+
+bool GarbageCollector::Link(QObject* Owner, const std::string& Property, QObject* Target)
 {
-    auto It = NameToObjectMap.find(DebugName);
-    return (It == NameToObjectMap.end()) ? nullptr : It->second; 
+    const Node* OwnerNode = FindNode(Owner);
+    if (!OwnerNode)
+    {
+        std::cout << "[Link] Owner is not GC-managed\n";
+        return false;
+    }
+    const Node* TargetNode = Target ? FindNode(Target) : nullptr;
+    if (Target && !TargetNode)
+    {
+        std::cout << "[Link] Target is not GC-managed\n";
+        return false;
+    }
+    
+    unsigned char* Base = BytePtr(Owner);
+    if (const qmeta::MetaProperty* Found = OwnerNode->Ti->FindProperty(Property))
+    {
+        const qmeta::MetaProperty& MetaProp = *Found;
+
+        if (TargetNode && MetaProp.ref_type && !TargetNode->Ti->IsA(*MetaProp.ref_type))
+        {
+            std::cout << "[Link] " << Target->GetDebugName() << " is not a " << MetaProp.ref_type->name << "\n";
+            return false;
+        }
+
+        if (IsPointerType(MetaProp))
+        {
+            NoteReferenceWrite(Owner, Target);
+            *reinterpret_cast<QObject**>(Base + MetaProp.offset) = Target;
+            return true;
+        }
+        if (IsVectorOfPointer(MetaProp))
+        {
+            if (!Target) return false;
+            NoteReferenceWrite(Owner, Target);
+            reinterpret_cast<std::vector<QObject*>*>(Base + MetaProp.offset)->push_back(Target);
+            return true;
+        }
+        
+        std::cout << "[Link] " << Property << " is not an object reference\n";
+        return false;
+    }
+    return false;
 }
 
-const TypeInfo* GarbageCollector::GetTypeInfo(const QObject* Obj) const
+void GarbageCollector::NoteReferenceWrite(QObject* Owner, QObject* Target)
 {
-    auto It = Objects.find(const_cast<QObject*>(Obj));
-    return It == Objects.end() ? nullptr : It->second.Ti;
+    const Node* OwnerNode = FindNode(Owner);
+    if (!OwnerNode)
+    {
+        return;
+    }
+    
+    DissolveClusterOf(Owner);
+    if (Target)
+    {
+        NoteCrossRegionRef(OwnerNode->RegionIndex, Target);
+        ForkCollect.bInvalidated = true;
+    }
 }
 
 bool GarbageCollector::Unlink(QObject* Object, const std::string& Property)
@@ -654,16 +2510,21 @@ bool GarbageCollector::Unlink(QObject* Object, const std::string& Property)
         return false;
     }
     
-    auto ObjectIter = Objects.find(Object);
+    const Node* ObjectNode = FindNode(Object);
+    if (!ObjectNode)
+    {
+        return false;
+    }
     unsigned char* Base = BytePtr(Object);
     
-    for (auto& MetaProp : ObjectIter->second.Ti->properties)
+    if (const qmeta::MetaProperty* Found = ObjectNode->Ti->FindProperty(Property))
     {
-        if (MetaProp.name != Property) continue;
+        const qmeta::MetaProperty& MetaProp = *Found;
         
         // Handle raw QObject*
         if (IsPointerType(MetaProp))
         {
+            DissolveClusterOf(Object);
             auto* Slot = reinterpret_cast<QObject**>(Base + MetaProp.offset);
             *Slot = nullptr;
             std::cout << "[Unlink] Name=" << Object->GetDebugName() << "." << Property << " -> null" << "\n";
@@ -673,6 +2534,7 @@ bool GarbageCollector::Unlink(QObject* Object, const std::string& Property)
         // Handle std::vector<QObject*>
         if (IsVectorOfPointer(MetaProp))
         {
+            DissolveClusterOf(Object);
             auto* Vec = reinterpret_cast<std::vector<QObject*>*>(Base + MetaProp.offset);
             // Remove all references held by the vector
             for (QObject*& E : *Vec) { E = nullptr; }
@@ -698,15 +2560,36 @@ bool GarbageCollector::UnlinkByName(const std::string& Name, const std::string&
     return Unlink(Obj, Property);
 }
 
-bool GarbageCollector::UnlinkAllByName(const std::string& Name)
+bool GarbageCollector::UnlinkById(uint64_t Id, const std::string& Property)
 {
-    QObject* Obj = FindByDebugName(Name);
+    QObject* Obj = FindById(Id);
+    if (!Obj)
+    {
+        std::cout << "[Unlink] Object not found by Id: " << Id << "\n";
+        return false;
+    }
     
+    return Unlink(Obj, Property);
+}
+
+bool GarbageCollector::UnlinkAllById(uint64_t OwnerId)
+{
+    return UnlinkAll(FindById(OwnerId));
+}
+
+bool GarbageCollector::UnlinkAllByName(const std::string& Name)
+{
+    return UnlinkAll(FindByDebugName(Name));
+}
+
+bool GarbageCollector::UnlinkAll(QObject* Obj)
+{
     if (!Obj) return false;
 
-    auto ObjectIter = Objects.find(Obj);
-    unsigned char* Base = BytePtr(Obj);
-    for (auto& MetaProp : ObjectIter->second.Ti->properties)
+    const Node* ObjectNode = FindNode(Obj);
+    if (!ObjectNode) return false;
+    
+    for (auto& MetaProp : ObjectNode->Ti->properties)
     {
         Unlink(Obj, MetaProp.name);
     }
@@ -716,57 +2599,393 @@ bool GarbageCollector::UnlinkAllByName(const std::string& Name)
 
 bool GarbageCollector::SetProperty(QObject* Obj, const std::string& Property, const std::string& Value)
 {
-    auto It = Objects.find(Obj);
-    if (It == Objects.end()) return false;
+    const Node* N = FindNode(Obj);
+    if (!N) return false;
     unsigned char* Base = BytePtr(Obj);
 
-    for (auto& p : It->second.Ti->properties)
+    const qmeta::MetaProperty* P = N->Ti->FindProperty(Property);
+    if (!P) return false;
+
+    ForkCollect.bInvalidated = true;
+
+    // Reference writes go through Link so the region, fork and cluster bookkeeping sees the new edge.
+    if (IsPointerType(*P) || IsVectorOfPointer(*P))
+    {
+        QObject* Target = (Value == "null") ? nullptr : FindByNameOrId(Value);
+        return (Target || Value == "null") && Link(Obj, Property, Target);
+    }
+
+    const qmeta::PropertyTypeOps& Ops = qmeta::GetPropertyTypeOps(*P);
+    return Ops.Parse && Ops.Parse(Base + P->offset, Value);
+}
+
+bool GarbageCollector::SetPropertyById(uint64_t Id, const std::string& Property, const std::string& Value)
+{
+    QObject* Obj = FindById(Id);
+    if (!Obj) return false;
+
+    return SetProperty(Obj, Property, Value);
+}
+
+bool GarbageCollector::SetPropertyByName(const std::string& Name, const std::string& Property, const std::string& Value)
+{
+    QObject* Obj = FindByDebugName(Name);
+    if (!Obj) return false;
+
+    return SetProperty(Obj, Property, Value);
+}
+
+namespace
+{
+    // Number of threads a bulk pass over Count instances is split into.
+    size_t BulkThreadCount(size_t Count)
     {
-        if (p.name != Property) continue;
+        if (Count < GarbageCollector::BulkParallelMinInstances) return 1;
+        const size_t Hw = std::max<size_t>(1, std::thread::hardware_concurrency());
+        return std::min<size_t>({ Hw, 16, Count / (GarbageCollector::BulkParallelMinInstances / 4) });
+    }
 
-        if (p.type == "int" || p.type == "int32_t")
+    // Runs F(Begin, End, Chunk) over NumChunks contiguous slices of [0, Count); slice 0 runs on the calling thread.
+    template<class Fn>
+    void ForEachBulkChunk(size_t Count, size_t NumChunks, const Fn& F)
+    {
+        const size_t Per = (Count + NumChunks - 1) / NumChunks;
+        std::vector<std::thread> Threads;
+        Threads.reserve(NumChunks - 1);
+        for (size_t Chunk = 1; Chunk < NumChunks; ++Chunk)
         {
-            *reinterpret_cast<int*>(Base + p.offset) = std::stoi(Value);
-            return true;
+            const size_t Begin = Chunk * Per;
+            if (Begin >= Count) break;
+            Threads.emplace_back(F, Begin, std::min(Count, Begin + Per), Chunk);
         }
-        else if (p.type == "float")
+        F(0, std::min(Count, Per), size_t(0));
+        for (std::thread& T : Threads) T.join();
+    }
+
+    template<class T>
+    struct TBulkAggregate
+    {
+        using SumType = std::conditional_t<std::is_floating_point_v<T>, double,
+                        std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+        SumType Sum = 0;
+        T Min = std::numeric_limits<T>::max();
+        T Max = std::numeric_limits<T>::lowest();
+    };
+
+    // Gathers the field into a contiguous batch first, so the reduction runs over packed values and vectorizes.
+    template<class T>
+    void AggregateRange(QObject* const* Objs, size_t Count, size_t Offset, TBulkAggregate<T>& Acc)
+    {
+        constexpr size_t BatchSize = 256;
+        T Batch[BatchSize];
+        for (size_t i = 0; i < Count; i += BatchSize)
         {
-            *reinterpret_cast<float*>(Base + p.offset) = std::stof(Value);
-            return true;
+            const size_t N = std::min(BatchSize, Count - i);
+            for (size_t k = 0; k < N; ++k)
+            {
+                Batch[k] = *reinterpret_cast<const T*>(reinterpret_cast<const unsigned char*>(Objs[i + k]) + Offset);
+            }
+            typename TBulkAggregate<T>::SumType Sum = 0;
+            T Min = Acc.Min;
+            T Max = Acc.Max;
+            for (size_t k = 0; k < N; ++k)
+            {
+                Sum += Batch[k];
+                Min = Batch[k] < Min ? Batch[k] : Min;
+                Max = Batch[k] > Max ? Batch[k] : Max;
+            }
+            Acc.Sum += Sum;
+            Acc.Min = Min;
+            Acc.Max = Max;
         }
-        else if (p.type == "double")
+    }
+}
+
+void GarbageCollector::AddInstance(QObject* Obj, Node& N)
+{
+    if (InstancesByType.size() <= N.Ti->type_index)
+    {
+        InstancesByType.resize(N.Ti->type_index + 1);
+    }
+    std::vector<QObject*>& List = InstancesByType[N.Ti->type_index];
+    N.TypeSlot = static_cast<uint32_t>(List.size());
+    List.push_back(Obj);
+}
+
+void GarbageCollector::RemoveInstance(QObject* Obj, const Node& N)
+{
+    std::vector<QObject*>& List = InstancesByType[N.Ti->type_index];
+    QObject* Last = List.back();
+    if (Last != Obj)
+    {
+        List[N.TypeSlot] = Last;
+        const_cast<Node*>(FindNode(Last))->TypeSlot = N.TypeSlot;
+    }
+    List.pop_back();
+}
+
+std::span<QObject* const> GarbageCollector::GetInstanceSpan(const TypeInfo& Type, std::vector<QObject*>& Scratch) const
+{
+    const qmeta::Registry& Registry = qmeta::GetRegistry();
+    const std::vector<QObject*>* Only = nullptr;
+    size_t NumLists = 0;
+    for (size_t Index = 0; Index < InstancesByType.size(); ++Index)
+    {
+        const std::vector<QObject*>& List = InstancesByType[Index];
+        const TypeInfo* Ti = List.empty() ? nullptr : Registry.find_by_index(static_cast<uint16_t>(Index));
+        if (!Ti || !Ti->IsA(Type))
         {
-            *reinterpret_cast<double*>(Base + p.offset) = std::stod(Value);
-            return true;
+            continue;
         }
-        else if (p.type == "bool")
+        if (NumLists++ == 0)
         {
-            *reinterpret_cast<bool*>(Base + p.offset) = (Value == "true" || Value == "1");
-            return true;
+            Only = &List;
+            continue;
         }
-        else if (p.type == "std::string" || p.type == "string")
+        if (NumLists == 2)
         {
-            *reinterpret_cast<std::string*>(Base + p.offset) = Value;
-            return true;
+            Scratch.assign(Only->begin(), Only->end());
         }
+        Scratch.insert(Scratch.end(), List.begin(), List.end());
     }
-    return false;
+
+    if (NumLists == 0) return {};
+    if (NumLists == 1) return *Only;
+    return Scratch;
 }
 
-bool GarbageCollector::SetPropertyByName(const std::string& Name, const std::string& Property, const std::string& Value)
+std::vector<QObject*> GarbageCollector::GetInstancesOf(const TypeInfo& Type) const
 {
-    QObject* Obj = FindByDebugName(Name);
-    if (!Obj) return false;
+    std::vector<QObject*> Scratch;
+    const std::span<QObject* const> Instances = GetInstanceSpan(Type, Scratch);
+    return std::vector<QObject*>(Instances.begin(), Instances.end());
+}
 
-    return SetProperty(Obj, Property, Value);
+bool GarbageCollector::SetPropertyForAll(const std::string& Type, const std::string& Property, const std::string& Value, size_t& OutNumSet)
+{
+    OutNumSet = 0;
+    if (!IsGameThread())
+    {
+        std::cout << "[SetAll] Must be called on the game thread\n";
+        return false;
+    }
+    const TypeInfo* Ti = qmeta::GetRegistry().find(Type);
+    if (!Ti)
+    {
+        std::cout << "[SetAll] Unknown type: " << Type << "\n";
+        return false;
+    }
+    const MetaProperty* P = Ti->FindProperty(Property);
+    if (!P)
+    {
+        std::cout << "[SetAll] " << Type << " has no property " << Property << "\n";
+        return false;
+    }
+
+    // Mutators stay parked while the worker threads write; objects created off-thread are merged first.
+    FGcStopTheWorldScope StopScope;
+    FlushRegistrationsInternal(nullptr);
+
+    std::vector<QObject*> Scratch;
+    const std::span<QObject* const> Instances = GetInstanceSpan(*Ti, Scratch);
+    const size_t Offset = P->offset;
+    bool bParsed = false;
+
+    const bool bScalar = qmeta::VisitScalarPropertyType(P->type_code, [&]<class T>(std::type_identity<T>)
+    {
+        T Parsed{};
+        bParsed = qmeta::GetPropertyTypeOps(*P).Parse(&Parsed, Value);
+        if (!bParsed) return;
+
+        auto Scatter = [Instances, &Parsed, Offset](size_t Begin, size_t End, size_t)
+        {
+            for (size_t i = Begin; i < End; ++i)
+            {
+                *reinterpret_cast<T*>(BytePtr(Instances[i]) + Offset) = Parsed;
+            }
+        };
+
+        // Strings allocate on assignment; keep them on this thread.
+        const size_t NumChunks = std::is_same_v<T, std::string> ? 1 : BulkThreadCount(Instances.size());
+        ForEachBulkChunk(Instances.size(), NumChunks, Scatter);
+    });
+
+    if (!bScalar)
+    {
+        std::cout << "[SetAll] " << Type << "." << Property << " (" << P->type << ") is not a scalar property\n";
+        return false;
+    }
+    if (!bParsed)
+    {
+        std::cout << "[SetAll] Invalid value for " << P->type << ": " << Value << "\n";
+        return false;
+    }
+
+    OutNumSet = Instances.size();
+    return true;
+}
+
+bool GarbageCollector::AggregateProperty(const std::string& Type, const std::string& Property, FPropertyAggregate& Out)
+{
+    Out = {};
+    if (!IsGameThread())
+    {
+        std::cout << "[Aggregate] Must be called on the game thread\n";
+        return false;
+    }
+    const TypeInfo* Ti = qmeta::GetRegistry().find(Type);
+    if (!Ti)
+    {
+        std::cout << "[Aggregate] Unknown type: " << Type << "\n";
+        return false;
+    }
+    const MetaProperty* P = Ti->FindProperty(Property);
+    if (!P)
+    {
+        std::cout << "[Aggregate] " << Type << " has no property " << Property << "\n";
+        return false;
+    }
+
+    FGcStopTheWorldScope StopScope;
+    FlushRegistrationsInternal(nullptr);
+
+    std::vector<QObject*> Scratch;
+    const std::span<QObject* const> Instances = GetInstanceSpan(*Ti, Scratch);
+    const size_t Offset = P->offset;
+    bool bNumeric = false;
+
+    qmeta::VisitScalarPropertyType(P->type_code, [&]<class T>(std::type_identity<T>)
+    {
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+        {
+            bNumeric = true;
+            if (Instances.empty()) return;
+
+            const size_t NumChunks = BulkThreadCount(Instances.size());
+            std::vector<TBulkAggregate<T>> Partials(NumChunks);
+            ForEachBulkChunk(Instances.size(), NumChunks, [&](size_t Begin, size_t End, size_t Chunk)
+            {
+                AggregateRange<T>(Instances.data() + Begin, End - Begin, Offset, Partials[Chunk]);
+            });
+
+            TBulkAggregate<T> Total;
+            for (const TBulkAggregate<T>& Part : Partials)
+            {
+                Total.Sum += Part.Sum;
+                Total.Min = std::min(Total.Min, Part.Min);
+                Total.Max = std::max(Total.Max, Part.Max);
+            }
+            Out.Count = Instances.size();
+            Out.Sum = qmeta::Variant(Total.Sum);
+            Out.Min = qmeta::Variant(Total.Min);
+            Out.Max = qmeta::Variant(Total.Max);
+        }
+    });
+
+    if (!bNumeric)
+    {
+        std::cout << "[Aggregate] " << Type << "." << Property << " (" << P->type << ") is not numeric\n";
+        return false;
+    }
+    return true;
 }
 
-qmeta::Variant GarbageCollector::Call(QObject* Obj, const std::string& FuncName, const std::vector<qmeta::Variant>& Args)
+qmeta::Variant GarbageCollector::Call(QObject* Obj, const std::string& FuncName, std::span<const qmeta::Variant> Args)
 {
     if (!Obj) throw std::runtime_error("Object not found");
-    auto It = Objects.find(Obj);
-    if (It == Objects.end()) throw std::runtime_error("Not GC-managed");
-    return qmeta::CallByName(Obj, *It->second.Ti, FuncName, Args);
+    const Node* N = FindNode(Obj);
+    if (!N) throw std::runtime_error("Not GC-managed");
+
+    OnReflectedMutation(Obj);
+    qmeta::Variant Result = qmeta::CallByName(Obj, *N->Ti, FuncName, Args);
+    OnReflectedMutation(Obj);
+    return Result;
+}
+
+void GarbageCollector::OnReflectedMutation(QObject* Obj)
+{
+    // Before, so a throwing call is still covered; after, because the call may have run a full collection (and
+    // re-clustered Obj) before writing.
+    DissolveClusterOf(Obj);
+    bRegionRefsDirty = true;
+    ForkCollect.bInvalidated = true;
+}
+
+qmeta::FunctionHandle GarbageCollector::FindFunction(const QObject* Obj, std::string_view FuncName) const
+{
+    const TypeInfo* Ti = Obj ? GetTypeInfo(Obj) : nullptr;
+    return Ti ? qmeta::FunctionHandle::Resolve(*Ti, FuncName) : qmeta::FunctionHandle{};
+}
+
+qmeta::Variant GarbageCollector::Call(QObject* Obj, const qmeta::FunctionHandle& Func, std::span<const qmeta::Variant> Args)
+{
+    if (!Obj) throw std::runtime_error("Object not found");
+    if (!Func.IsValid()) throw std::runtime_error("Unresolved function handle");
+
+    const TypeInfo* Ti = qmeta::GetRegistry().find_by_index(Obj->GetTypeIndex());
+    if (!Ti || !Func.Matches(*Ti))
+    {
+        throw std::runtime_error(Func.Type->name + "." + Func.Func->name + " does not apply to this object's type");
+    }
+
+    OnReflectedMutation(Obj);
+    qmeta::Variant Result = Func.Invoke(Obj, Args);
+    OnReflectedMutation(Obj);
+    return Result;
+}
+
+bool GarbageCollector::Save(uint64_t Id, const std::string& FileNameIfAny)
+{
+    QObject* Obj = FindById(Id);
+    const Node* N = FindNode(Obj);
+    if (!N)
+    {
+        std::cout << "[Save] Object not found by Id: " << Id << "\n";
+        return false;
+    }
+
+    const std::string FileName = FileNameIfAny.empty() ? Obj->GetDebugName() + ".qasset" : FileNameIfAny;
+    return qasset::Save(Obj, *N->Ti, qasset::DefaultAssetDirFor(*N->Ti), FileName);
+}
+
+bool GarbageCollector::Load(uint64_t Id, const std::string& FileNameIfAny)
+{
+    QObject* Obj = FindById(Id);
+    const Node* N = FindNode(Obj);
+    if (!N)
+    {
+        std::cout << "[Load] Object not found by Id: " << Id << "\n";
+        return false;
+    }
+
+    // References are resolved by name, which still finds snapshot garbage.
+    ForkCollect.bInvalidated = true;
+    OnReflectedMutation(Obj);
+
+    auto Resolve = [this, Obj](const qmeta::ObjectRefKey& Key, const qmeta::MetaProperty& P) -> QObject*
+    {
+        QObject* Target = FindByDebugName(Key.Name);
+        const TypeInfo* TargetTi = Target ? GetTypeInfo(Target) : nullptr;
+        if (!TargetTi || TargetTi->name != Key.TypeName || (P.ref_type && !TargetTi->IsA(*P.ref_type)))
+        {
+            std::cout << "[Load] " << P.name << ": no " << Key.TypeName << " named " << Key.Name
+                      << " fits this property, reference dropped\n";
+            return nullptr;
+        }
+        NoteReferenceWrite(Obj, Target);
+        return Target;
+    };
+    
+    const std::string FileName = FileNameIfAny.empty() ? Obj->GetDebugName() + ".qasset" : FileNameIfAny;
+    return qasset::Load(Obj, *N->Ti, qasset::DefaultAssetDirFor(*N->Ti) / FileName, Resolve);
+}
+
+qmeta::Variant GarbageCollector::CallById(uint64_t Id, const std::string& Function, const std::vector<qmeta::Variant>& Args)
+{
+    QObject* Obj = FindById(Id);
+    if (!Obj) throw std::runtime_error("Object not found by Id");
+
+    return Call(Obj, Function, Args);
 }
 
 qmeta::Variant GarbageCollector::CallByName(const std::string& Name, const std::string& Function, const std::vector<qmeta::Variant>& Args)
@@ -1,5 +1,12 @@
 ﻿#pragma once
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
 #include "Object.h"
+#include "ObjectAllocator.h"
 #include "qmeta_runtime.h"
 
 class GarbageCollector
@@ -19,18 +26,70 @@ public:
     static QObject* NewObjectByName(const std::string& TypeName);
     
     // Roots
-    std::vector<QObject*> GetRoots() const { return Roots; }
+    // Pins are reference counted: an object stays a root until every AddRoot has a matching RemoveRoot.
+    const std::vector<QObject*>& GetRoots() const { return Roots; }
     void AddRoot(QObject* Obj);
     void RemoveRoot(QObject* Obj);
+    bool IsRoot(const QObject* Obj) const { return Obj && RootSlots.contains(const_cast<QObject*>(Obj)); }
+    uint32_t GetRootPinCount(const QObject* Obj) const;
     
     // GC steps
     void Tick(double DeltaSeconds);
 
     // Return execution time(ms).
+    // In fork mode this only starts the collection and returns the time spent forking the marker.
     double Collect(bool bSilent = false);
 
+    // --- Collection mode ---
+    // Fork (Linux only, experimental): Collect() forks, and the child marks the copy-on-write snapshot of the heap and
+    // writes the dead list back over a pipe while the game keeps running. Tick() picks the list up and runs fixup and
+    // sweep in a short pause, which is safe because objects that were garbage in the snapshot are still garbage.
+    // Objects created after the fork survive until the next collection. AddRoot(), Link(), SetProperty(), Load()
+    // and reflected calls can make snapshot garbage reachable again, so any of them discards the pending result;
+    // objects that are GC roots when the result is applied are never swept.
+    enum class EGcMode : uint8_t
+    {
+        StopTheWorld,
+        Fork
+    };
+    
+    // Returns false if the mode is not supported on this platform. Leaving fork mode finishes a pending collection.
+    bool SetMode(EGcMode NewMode);
+    EGcMode GetMode() const { return Mode; }
+    
+    bool IsForkCollectPending() const { return ForkCollect.Pid > 0; }
+    
+    // Sweeps the result of a pending fork collection if the child has finished, or waits for it with bWait.
+    // Returns true once the pending collection is done (swept or discarded).
+    bool FinishForkCollect(bool bWait = false);
+
+    // Phase timings and counts of the last Collect().
+    struct FGcStats
+    {
+        double ClearMs = 0.0;
+        double MarkMs = 0.0;
+        double BuildDeadMs = 0.0;
+        double FixupMs = 0.0;
+        double SweepMs = 0.0;
+        double TotalMs = 0.0;
+        size_t NumCollected = 0;
+        size_t NumAlive = 0;
+        size_t NumPermanent = 0;
+        size_t NumPendingKill = 0;  // swept objects still waiting for IsReadyForFinishDestroy()
+        double SafepointMs = 0.0;   // waiting for registered mutators to park, not part of TotalMs
+        size_t NumMutatorsStopped = 0;
+        double ForkMs = 0.0;        // fork mode: pause to fork the marker, not part of TotalMs (MarkMs ran in the child)
+        size_t NumStackRoots = 0;   // objects pinned by the conservative stack scan
+    };
+    const FGcStats& GetLastStats() const { return LastStats; }
+
     void SetAutoInterval(double Seconds);
 
+    // Finishes pending-kill objects that report IsReadyForFinishDestroy(). Called from Tick.
+    // With bWaitAll, spins until the list is empty. Returns the number of objects destroyed.
+    size_t ProcessPendingKill(bool bWaitAll = false);
+    size_t GetNumPendingKill() const { return PendingKill.size(); }
+
     // Debug utilities
     void ListObjects() const;
     void ListPropertiesByDebugName(const std::string& Name) const;
@@ -39,31 +98,180 @@ public:
     void SetAllowTraverseParents(bool bEnable);
     bool GetAllowTraverseParents() const;
     
+    // Points a QObject* property at Target, or appends Target to a std::vector<QObject*> property.
+    bool Link(QObject* Owner, const std::string& Property, QObject* Target);
+
+    // Write barrier for native code that stores Target in one of Owner's reflected reference slots: dissolves
+    // Owner's cluster, records the edge for root regions and discards a pending fork result. Link() calls it.
+    void NoteReferenceWrite(QObject* Owner, QObject* Target);
+    
     bool Unlink(QObject* Object, const std::string& Property);
-    //bool UnlinkById(uint64_t Id, const std::string& Property);
+    bool UnlinkById(uint64_t Id, const std::string& Property);
     bool UnlinkByName(const std::string& Name, const std::string& Property);
-    //bool UnlinkAllById(uint64_t OwnerId);
+    bool UnlinkAll(QObject* Obj);
+    bool UnlinkAllById(uint64_t OwnerId);
     bool UnlinkAllByName(const std::string& Name);
     bool SetProperty(QObject* Obj, const std::string& Property, const std::string& Value);
-    //bool SetPropertyById(uint64_t Id, const std::string& Property, const std::string& Value);
+    bool SetPropertyById(uint64_t Id, const std::string& Property, const std::string& Value);
     bool SetPropertyByName(const std::string& Name, const std::string& Property, const std::string& Value);
 
-    qmeta::Variant Call(QObject* Obj, const std::string& FuncName, const std::vector<qmeta::Variant>& Args);
-    //qmeta::Variant CallById(uint64_t Id, const std::string& Function, const std::vector<qmeta::Variant>& Args);
+    // Bulk property access over every live instance of a type, subclasses included. The property is resolved once
+    // on the type and the per-type instance lists are streamed directly; batches of at least
+    // BulkParallelMinInstances objects are split across threads. Game thread only: the world is stopped for the
+    // duration of the call, so registered mutators never observe a half-applied write.
+    static constexpr size_t BulkParallelMinInstances = 1 << 16;
+    struct FPropertyAggregate
+    {
+        size_t Count = 0;
+        qmeta::Variant Sum;     // int64/uint64 for integers, double for floating point
+        qmeta::Variant Min;
+        qmeta::Variant Max;
+    };
+    std::vector<QObject*> GetInstancesOf(const qmeta::TypeInfo& Type) const;
+    // Parses Value once and writes it to every instance. Scalar properties only (numbers, bool, std::string).
+    bool SetPropertyForAll(const std::string& Type, const std::string& Property, const std::string& Value, size_t& OutNumSet);
+    // Sum/min/max of a numeric property over every instance. Count is 0 (and the Variants empty) when there are none.
+    bool AggregateProperty(const std::string& Type, const std::string& Property, FPropertyAggregate& Out);
+
+    qmeta::Variant Call(QObject* Obj, const std::string& FuncName, std::span<const qmeta::Variant> Args);
+    qmeta::Variant Call(QObject* Obj, const std::string& FuncName, const std::vector<qmeta::Variant>& Args)
+    {
+        return Call(Obj, FuncName, std::span<const qmeta::Variant>(Args));
+    }
+    qmeta::Variant CallById(uint64_t Id, const std::string& Function, const std::vector<qmeta::Variant>& Args);
     qmeta::Variant CallByName(const std::string& Name, const std::string& Function, const std::vector<qmeta::Variant>& Args);
 
+    // Resolves FuncName once on Obj's type. Reflection data never changes after link_bases(), so the handle can be
+    // kept for the session and reused on any object whose type it Matches(). Invalid if Obj is unknown.
+    qmeta::FunctionHandle FindFunction(const QObject* Obj, std::string_view FuncName) const;
+    // Calls through a resolved handle: no name or node lookup, the type comes from the object header.
+    // Throws if the handle is invalid or does not match Obj's type.
+    qmeta::Variant Call(QObject* Obj, const qmeta::FunctionHandle& Func, std::span<const qmeta::Variant> Args);
+
     // Asset IO
-    
-    //bool Save(uint64_t Id, const std::string& FileNameIfAny);
-    //bool Load(uint64_t Id, const std::string& FileNameIfAny);
+    // Files default to <Module>/Contents/<DebugName>.qasset. Object references are stored as type + debug name.
+    // On load a reference resolves only to a live object with that name and exact type that is also a valid
+    // target for the property; the write goes through the same barrier as Link(). Anything else is dropped.
+    bool Save(uint64_t Id, const std::string& FileNameIfAny);
+    bool Load(uint64_t Id, const std::string& FileNameIfAny);
     
     // Lookup
-    //QObject* FindById(uint64_t Id) const;
+    // Two array loads: no hashing, no allocation. Null for ids never registered or already swept.
+    QObject* FindById(uint64_t Id) const
+    {
+        const size_t Page = static_cast<size_t>(Id >> IdPageShift);
+        if (Page >= IdPages.size() || !IdPages[Page].Slots)
+        {
+            return nullptr;
+        }
+        return IdPages[Page].Slots[Id & (IdPageSize - 1)];
+    }
     QObject* FindByDebugName(const std::string& DebugName) const;
     
+    // "#123" resolves by id, anything else by debug name.
+    QObject* FindByNameOrId(const std::string& Token) const;
+    
     // Access stored TypeInfo for an object
     const qmeta::TypeInfo* GetTypeInfo(const QObject* Obj) const;
 
+    // Debug aid: calls OnRef for every reflected reference from a managed object to a target accepted by IsTarget.
+    // Returns the number of references found.
+    size_t FindReferencesTo(const std::function<bool(const QObject*)>& IsTarget,
+                            const std::function<void(const QObject* Owner, const QObject* Target)>& OnRef) const;
+
+    // --- Clusters ---
+    // A cluster is marked as a single unit: the root and its members share one mark, and only references
+    // leaving the cluster plus the root's own slots are traced. Members are treated as frozen, so edges added
+    // between members after formation are ignored until the cluster is dissolved. Link, Unlink, SetProperty, Load
+    // and reflected calls dissolve the cluster of the object they write to or run on; native code writing member
+    // pointers directly must go through NoteReferenceWrite (or call DissolveCluster) itself.
+    
+    // Forms a cluster from Root and everything reachable from it that is not a GC root or in another cluster.
+    // Returns the member count (including Root), or 0 on failure.
+    size_t CreateCluster(QObject* Root);
+    bool DissolveCluster(QObject* Root);
+    void DissolveAllClusters();
+    
+    // Automatically cluster GC roots whose subgraph survived N collections. 0 disables.
+    void SetAutoClusterAfter(uint32_t NumCollections) { AutoClusterAfter = NumCollections; }
+    uint32_t GetAutoClusterAfter() const { return AutoClusterAfter; }
+    
+    size_t GetNumClusters() const { return Clusters.size() - FreeClusterIndices.size(); }
+    bool IsInCluster(const QObject* Obj) const;
+    
+    // --- Object pools ---
+    // Storage comes from the slab allocator, whose size classes recycle swept slots directly. Types too large for
+    // the slab keep per-TypeInfo free lists (up to PoolCapPerType blocks) in front of the system allocator.
+    void* AllocateObjectMemory(const qmeta::TypeInfo& Ti);
+    void FreeObjectMemory(const qmeta::TypeInfo& Ti, void* Mem);
+    
+    void SetPoolCap(size_t BlocksPerType);
+    size_t GetPoolCap() const { return PoolCapPerType; }
+    
+    // Hands pooled blocks above KeepPerType back to the slab, then unmaps empty slab pages.
+    // Returns the number of bytes unmapped.
+    size_t TrimPools(size_t KeepPerType = 0);
+    void ListPools() const;
+    
+    // --- Compaction ---
+    // Moves surviving slab objects into fresh pages in DFS order from the roots and rewrites every reflected
+    // reference to them. Roots, permanent objects, large objects and types without TypeInfo::relocate (pinned via
+    // bGcPinned) stay in place. Unreflected QObject* must be remapped in QObject::PostGcCompact.
+    // Call it at a frame boundary only: a member function running on a moved object would keep using the old slot.
+    // Returns the number of objects moved.
+    size_t Compact(bool bSilent = false);
+    // Compaction after a collection is deferred to the start of the next Tick(), so a Collect() issued from inside
+    // a reflected method never moves the object that method runs on.
+    void SetCompactAfterCollect(bool bEnable) { bCompactAfterCollect = bEnable; }
+    bool GetCompactAfterCollect() const { return bCompactAfterCollect; }
+    
+    // --- Off-thread creation ---
+    // NewObject may run on any thread. Objects created off the game thread (the thread that created the GC) go to a
+    // per-thread registration buffer and only enter the GC tables when FlushRegistrations() runs on the game thread.
+    // Collect() flushes first and traces the merged objects as roots for that one collection, so a graph that is
+    // still being handed over survives it. Until merged, an object is visible to GetTypeInfo() on its creating
+    // thread only, and the creating thread must not mutate it while a collection runs (see GcSafepoint.h).
+    size_t FlushRegistrations();
+    bool IsGameThread() const { return std::this_thread::get_id() == GameThreadId; }
+    
+    // --- Permanent region ---
+    // Objects registered while a region is open (or moved by MakePermanent) live outside Objects: they are never
+    // marked, swept or fixed up. Their references are scanned only when they are GC roots or were flagged with
+    // bReferencesAsRoots; an unflagged permanent object must therefore only point at other permanent objects.
+    void BeginPermanentRegion(bool bReferencesAsRoots = false);
+    void EndPermanentRegion();
+    bool IsInPermanentRegion() const { return !PermanentRegionStack.empty(); }
+    
+    bool MakePermanent(QObject* Obj, bool bReferencesAsRoots = false);
+    bool IsPermanent(const QObject* Obj) const { return PermanentObjects.contains(const_cast<QObject*>(Obj)); }
+    size_t GetNumPermanent() const { return PermanentObjects.size(); }
+
+    // --- Conservative stack scan ---
+    // Linux only, off by default. Each collection also roots every managed object whose start address appears as an
+    // aligned word on the stack or in the saved registers of the collecting thread and of stopped mutators (see
+    // GcVisitThreadStacks), so a QObject* kept in a local across a Tick survives without AddRoot. Those objects are
+    // pinned against compaction too. Threads that are not registered mutators are not scanned, and stale stack words
+    // can keep garbage alive for a few more collections. Returns false if unsupported.
+    bool SetConservativeStackScan(bool bEnable);
+    bool GetConservativeStackScan() const { return bConservativeStackScan; }
+
+    // --- Root regions ---
+    // Objects created on the game thread while a root region is open are owned by that region's root.
+    // CollectRegion(Root) traces from the region's GC roots through its members only and sweeps only unreachable
+    // members, so a subsystem's garbage is reclaimed without paying for the whole heap. Objects outside the region
+    // must not reference its members (the root itself is fine): every full Collect(), Link() and NoteReferenceWrite()
+    // records such cross-region edges, and CollectRegion falls back to a full Collect() while any are known. A
+    // reflected call or asset load may store references anywhere, so after one CollectRegion also falls back until
+    // the next full Collect(). Other native writes must go through NoteReferenceWrite(). Clustered members are only
+    // swept by a full Collect().
+    void BeginRootRegion(QObject* Root);
+    void EndRootRegion();
+    bool RemoveRootRegion(QObject* Root);
+
+    double CollectRegion(QObject* Root, bool bSilent = false);
+    size_t GetRegionSize(const QObject* Root) const;
+    size_t GetNumRegions() const { return RegionByRoot.size(); }
+
 public:
     void SetParallelMarkPerRoot(bool bEnable) { bParallelMarkPerRoot = bEnable; }
     bool GetParallelMarkPerRoot() const { return bParallelMarkPerRoot; }
@@ -73,14 +281,42 @@ private:
     bool bParallelMarkPerRoot = true;
     
 public:
-    void RegisterInternal(QObject* Obj, const qmeta::TypeInfo& Ti, const std::string& Name, uint64_t Id);
+    void RegisterInternal(QObject* Obj, const qmeta::TypeInfo& Ti, uint64_t Id);
 
 private:
+    std::thread::id GameThreadId = std::this_thread::get_id();
+    
+    struct FPendingRegistration
+    {
+        const qmeta::TypeInfo* Ti = nullptr;
+        uint64_t Id = 0;
+    };
+
+    // Owned by one creating thread; the mutex is only contended while the game thread flushes it.
+    struct FRegistrationBuffer
+    {
+        std::mutex Mutex;
+        std::unordered_map<QObject*, FPendingRegistration> Items;
+    };
+
+    std::vector<std::shared_ptr<FRegistrationBuffer>> RegistrationBuffers;
+    std::mutex RegistrationBuffersMutex;
+
+    FRegistrationBuffer& GetThreadRegistrationBuffer();
+    size_t FlushRegistrationsInternal(std::vector<QObject*>* OutMerged);
+    void RegisterNow(QObject* Obj, const qmeta::TypeInfo& Ti, uint64_t Id);
+
     // --- GC fast paths ---
     struct FPtrOffsetLayout
     {
         std::vector<std::size_t> RawOffsets; // T*: QObject*
         std::vector<std::size_t> VecOffsets; // std::vector<T*>
+
+        // One bit per pointer-sized word of the object, set when that word holds a reflected QObject*.
+        std::vector<uint64_t> PtrBitmap;
+
+        // Leaf type: no reflected references at all. Objects are marked but never scanned.
+        bool bNoReferences = false;
     };
     
     struct Node
@@ -91,8 +327,139 @@ private:
 
         // Cached layout pointer (stable heap address)
         const FPtrOffsetLayout* Layout = nullptr;
+
+        // Index into Clusters, or -1 when not clustered.
+        int32_t ClusterIndex = -1;
+
+        // Number of collections survived (saturating), used by auto-clustering.
+        uint16_t SurvivedCount = 0;
+
+        // Index into Regions, or -1 when the object belongs to no root region.
+        int32_t RegionIndex = -1;
+
+        // Position in InstancesByType[Ti->type_index].
+        uint32_t TypeSlot = 0;
     };
 
+    // Live (managed and permanent) objects per exact type, indexed by TypeInfo::type_index. Kept in step with
+    // Objects by RegisterNow, SweepDead and Compact; removal swaps with the last entry.
+    std::vector<std::vector<QObject*>> InstancesByType;
+    void AddInstance(QObject* Obj, Node& N);
+    void RemoveInstance(QObject* Obj, const Node& N);
+    // The instances of Type and its subclasses: the type's own list when nothing else contributes, else Scratch.
+    std::span<QObject* const> GetInstanceSpan(const qmeta::TypeInfo& Type, std::vector<QObject*>& Scratch) const;
+
+    struct FGcCluster
+    {
+        QObject* Root = nullptr;
+        std::vector<QObject*> Members;      // includes Root
+        std::vector<QObject*> ExternalRefs; // references leaving the cluster
+        uint32_t MarkEpoch = 0;
+    };
+
+    std::vector<FGcCluster> Clusters;
+    std::vector<int32_t> FreeClusterIndices;
+    uint32_t AutoClusterAfter = 0;
+
+    size_t CreateClusterInternal(QObject* Root, uint16_t MinSurvived);
+    void ReleaseCluster(int32_t Index);
+    // Dissolves whichever cluster Obj roots or belongs to (reflected reference write on a frozen member).
+    void DissolveClusterOf(QObject* Obj);
+    int32_t FindClusterIndex(const QObject* Obj) const;
+    void AutoCluster();
+
+    struct FRootRegion
+    {
+        QObject* Root = nullptr;
+        std::unordered_set<QObject*> Members; // includes Root
+        bool bHasIncomingRefs = false;        // recomputed by every full Collect(), set by Link()
+    };
+
+    std::vector<FRootRegion> Regions;
+    std::vector<int32_t> FreeRegionIndices;
+    std::unordered_map<QObject*, int32_t> RegionByRoot;
+    std::vector<int32_t> RootRegionStack;
+
+    void AddToRegion(QObject* Obj, Node& N, int32_t Index);
+
+    // Drops Obj from its region, and releases the region Obj is the root of (its members become unowned).
+    void RemoveFromRegion(QObject* Obj, Node& N);
+
+    // Flags the target's region when a reference from another region (or from outside any) reaches a member.
+    void NoteCrossRegionRef(int32_t OwnerRegion, QObject* Target);
+
+    // Set by reflected calls and asset loads, cleared when a full collection recomputes the cross-region edges.
+    bool bRegionRefsDirty = false;
+
+    // Reflected calls and asset loads write references the collector does not see; called before and after.
+    // Dissolves Obj's cluster, flags region edges as unknown and discards a pending fork result.
+    void OnReflectedMutation(QObject* Obj);
+
+    bool IsMarked(const Node& N) const
+    {
+        return N.ClusterIndex >= 0 ? Clusters[N.ClusterIndex].MarkEpoch == CurrentEpoch : N.MarkEpoch == CurrentEpoch;
+    }
+
+    FGcStats LastStats;
+
+    struct FObjectPool
+    {
+        std::vector<void*> Free;
+        size_t Hits = 0;   // allocations served from Free
+        size_t Misses = 0; // allocations that went to the system allocator
+    };
+
+    std::unordered_map<const qmeta::TypeInfo*, FObjectPool> Pools;
+    size_t PoolCapPerType = 16384;
+
+    FObjectAllocator Allocator;
+    
+    // Guards Allocator and Pools, which NewObject reaches from any thread.
+    mutable std::mutex AllocatorMutex;
+
+    bool bCompactAfterCollect = false;
+    bool bCompactPending = false;       // set by a collection, run by the next Tick()
+    bool bCompactPendingSilent = true;
+
+    EGcMode Mode = EGcMode::StopTheWorld;
+
+    bool bConservativeStackScan = false;
+    
+    // Appends managed objects referenced from thread stacks (deduplicated). World must be stopped.
+    void GatherStackRoots(std::vector<QObject*>& Out);
+    
+    struct FForkDeadEntry
+    {
+        QObject* Obj = nullptr;
+        uint64_t Id = 0; // ids are never reused, so a slot that was swept and reused since the fork is told apart
+    };
+
+    struct FForkCollect
+    {
+        int Pid = 0;
+        int ReadFd = -1;
+        bool bSilent = false;
+        bool bInvalidated = false;
+        double ForkMs = 0.0;
+        size_t NumStackRoots = 0;
+        std::vector<unsigned char> Received;
+    };
+    FForkCollect ForkCollect;
+
+    double BeginForkCollect(bool bSilent);
+    void SweepForkResult(const FForkCollect& Result);
+
+    // Swept objects whose BeginDestroy() left asynchronous work running. Not in Objects; storage still allocated.
+    struct FPendingKill
+    {
+        QObject* Obj = nullptr;
+        const qmeta::TypeInfo* Ti = nullptr;
+    };
+    std::vector<FPendingKill> PendingKill;
+
+    // Runs FinishDestroy() and the destructor, then hands the storage to the pool.
+    void DestroyObject(QObject* Obj, const qmeta::TypeInfo& Ti);
+
     // Layout cache: stable addresses via unique_ptr so node Layout pointers never invalidate on rehash
     mutable std::unordered_map<const qmeta::TypeInfo*, std::unique_ptr<FPtrOffsetLayout>> PtrCache;
     mutable std::mutex PtrCacheMutex;
@@ -100,7 +467,24 @@ private:
     uint32_t CurrentEpoch = 1;
 
     const FPtrOffsetLayout* GetPtrLayout(const qmeta::TypeInfo& Ti);
-    
+
+    // Visits every non-null raw QObject* slot by walking the pointer bitmap word by word.
+    template <class F>
+    static void ForEachRawSlot(unsigned char* Base, const FPtrOffsetLayout& Layout, const F& Func);
+
+    // Starts a new mark epoch, resetting stored marks on wrap-around.
+    void BeginMarkEpoch();
+
+    // Nulls raw slots and erases vector entries that point into DeadSet.
+    static void ClearDeadRefs(QObject* Obj, const FPtrOffsetLayout& Layout, const std::unordered_set<QObject*>& DeadSet);
+
+    // Clears references to DeadSet from every object accepted by IsLive and re-checks root region ownership.
+    template <class FIsLive>
+    void FixupSurvivors(const std::unordered_set<QObject*>& DeadSet, const FIsLive& IsLive);
+
+    // Unlinks dead objects from the GC, then destroys them or queues them as pending kill.
+    void SweepDead(const std::vector<QObject*>& Dead);
+
     // Marks all objects from a root to kill by BFS 
     void Mark();
     size_t MarkFromRoot(QObject* Root);  // BFS from a single root (used by both single & multi)
@@ -110,10 +494,38 @@ private:
     
 private:
     std::unordered_map<QObject*, Node> Objects;
-    //std::unordered_map<uint64_t, QObject*> ById;
-    std::unordered_map<std::string, QObject*> NameToObjectMap;
+    
+    std::unordered_map<QObject*, Node> PermanentObjects;
+    std::vector<QObject*> PermanentRootSources; // permanent objects flagged bReferencesAsRoots
+    std::vector<bool> PermanentRegionStack;     // bReferencesAsRoots per open region
+
+    // Looks up a node in Objects, then PermanentObjects.
+    const Node* FindNode(const QObject* Obj) const;
+
+    // Id index: pages of IdPageSize slots allocated on first use. Ids are never reused, so a swept object leaves a
+    // null tombstone; a page left with only tombstones is freed.
+    static constexpr size_t IdPageShift = 12;
+    static constexpr size_t IdPageSize = size_t(1) << IdPageShift;
+    
+    struct FIdPage
+    {
+        std::unique_ptr<QObject*[]> Slots;
+        uint32_t NumLive = 0;
+    };
+    std::vector<FIdPage> IdPages;
+
+    void SetIdSlot(uint64_t Id, QObject* Obj);
+    void ClearIdSlot(uint64_t Id);
+    
+    // Dense root array (mark iterates it directly) + slot index for O(1) swap-remove.
+    struct FRootSlot
+    {
+        uint32_t Index = 0;
+        uint32_t PinCount = 0;
+    };
     
     std::vector<QObject*> Roots;
+    std::unordered_map<QObject*, FRootSlot> RootSlots;
     double Accumulated = 0.0;
     
     // Auto collect time interval in seconds. Disabled when less than or equal to zero.
@@ -137,3 +549,66 @@ private:
 
     bool bLogMarkStats = false;
 };
+
+// Registers every object created within the scope into the permanent region.
+class FGCPermanentRegionScope
+{
+public:
+    explicit FGCPermanentRegionScope(bool bReferencesAsRoots = false)
+    {
+        GarbageCollector::Get().BeginPermanentRegion(bReferencesAsRoots);
+    }
+    ~FGCPermanentRegionScope() { GarbageCollector::Get().EndPermanentRegion(); }
+
+    FGCPermanentRegionScope(const FGCPermanentRegionScope&) = delete;
+    FGCPermanentRegionScope& operator=(const FGCPermanentRegionScope&) = delete;
+};
+
+// Assigns every object created on the game thread within the scope to Root's region.
+class FGCRootRegionScope
+{
+public:
+    explicit FGCRootRegionScope(QObject* Root) { GarbageCollector::Get().BeginRootRegion(Root); }
+    ~FGCRootRegionScope() { GarbageCollector::Get().EndRootRegion(); }
+
+    FGCRootRegionScope(const FGCRootRegionScope&) = delete;
+    FGCRootRegionScope& operator=(const FGCRootRegionScope&) = delete;
+};
+
+// Pins an object as a GC root for the lifetime of the scope.
+class FGCScopedRoot
+{
+public:
+    FGCScopedRoot() = default;
+    explicit FGCScopedRoot(QObject* InObj) : Obj(InObj)
+    {
+        if (Obj) GarbageCollector::Get().AddRoot(Obj);
+    }
+    ~FGCScopedRoot() { Reset(); }
+
+    FGCScopedRoot(const FGCScopedRoot&) = delete;
+    FGCScopedRoot& operator=(const FGCScopedRoot&) = delete;
+
+    FGCScopedRoot(FGCScopedRoot&& Other) noexcept : Obj(Other.Obj) { Other.Obj = nullptr; }
+    FGCScopedRoot& operator=(FGCScopedRoot&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            Obj = Other.Obj;
+            Other.Obj = nullptr;
+        }
+        return *this;
+    }
+
+    void Reset()
+    {
+        if (Obj) GarbageCollector::Get().RemoveRoot(Obj);
+        Obj = nullptr;
+    }
+
+    QObject* Get() const { return Obj; }
+
+private:
+    QObject* Obj = nullptr;
+};
@@ -0,0 +1,342 @@
+﻿#include "GcSafepoint.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <ucontext.h>
+#endif
+
+namespace GcSafepointDetail
+{
+    std::atomic<bool> bStopRequested {false};
+}
+
+using GcSafepointDetail::bStopRequested;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct FMutatorState
+    {
+        std::string Name;
+        
+        // Owner thread only.
+        int UnsafeDepth = 0;
+
+        // Guarded by Mutex.
+        int SafeDepth = 0;
+        bool bParked = false;
+        uint64_t ParkedStopId = 0;
+        double LastTtspMs = 0.0;
+        double MaxTtspMs = 0.0;
+
+#if defined(__linux__)
+        // Conservative stack scanning. StoppedSp and StoppedContext are written by the owner before it counts as
+        // stopped, and read by the collector while it is.
+        const void* StackHigh = nullptr;
+        const void* StoppedSp = nullptr;
+        ucontext_t StoppedContext {};
+#endif
+    };
+
+    std::mutex Mutex;
+    std::condition_variable Cv;
+    std::vector<FMutatorState*> Mutators;
+
+    std::thread::id StopOwner;
+    int StopDepth = 0;
+    uint64_t StopId = 0;
+    Clock::time_point StopRequestedAt;
+
+    thread_local FMutatorState* ThisMutator = nullptr;
+
+    bool IsStopped(const FMutatorState& M)
+    {
+        return M.bParked || M.SafeDepth > 0;
+    }
+
+#if defined(__linux__)
+    const void* GetThreadStackHigh()
+    {
+        pthread_attr_t Attr;
+        if (pthread_getattr_np(pthread_self(), &Attr) != 0)
+        {
+            return nullptr;
+        }
+        
+        void* Addr = nullptr;
+        size_t Size = 0;
+        pthread_attr_getstack(&Attr, &Addr, &Size);
+        pthread_attr_destroy(&Attr);
+        return static_cast<const unsigned char*>(Addr) + Size;
+    }
+
+    // Not inlined: its frame is below every frame of the caller, so [frame, stack top) covers them all.
+    __attribute__((noinline)) void CaptureStoppedState(FMutatorState& M)
+    {
+        getcontext(&M.StoppedContext);
+        M.StoppedSp = __builtin_frame_address(0);
+    }
+#else
+    void CaptureStoppedState(FMutatorState&) {}
+#endif
+
+    // Lock held. Reports time-to-safepoint, then sleeps until the collector resumes the world.
+    void Park(std::unique_lock<std::mutex>& Lock, FMutatorState& M)
+    {
+        CaptureStoppedState(M);
+        
+        const double Ms = std::chrono::duration<double, std::milli>(Clock::now() - StopRequestedAt).count();
+        M.LastTtspMs = Ms;
+        M.MaxTtspMs = std::max(M.MaxTtspMs, Ms);
+        M.ParkedStopId = StopId;
+        M.bParked = true;
+        Cv.notify_all();
+
+        Cv.wait(Lock, [] { return !bStopRequested.load(std::memory_order_relaxed); });
+        M.bParked = false;
+    }
+}
+
+void GcSafepointDetail::SafepointSlow()
+{
+    FMutatorState* M = ThisMutator;
+    if (!M || M->UnsafeDepth > 0)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> Lock(Mutex);
+    if (bStopRequested.load(std::memory_order_relaxed) && StopOwner != std::this_thread::get_id())
+    {
+        Park(Lock, *M);
+    }
+}
+
+void GcRegisterMutator(const std::string& Name)
+{
+    if (ThisMutator)
+    {
+        return;
+    }
+
+    auto* M = new FMutatorState();
+    M->Name = Name;
+#if defined(__linux__)
+    M->StackHigh = GetThreadStackHigh();
+#endif
+
+    std::unique_lock<std::mutex> Lock(Mutex);
+    Mutators.push_back(M);
+    ThisMutator = M;
+
+    // A collection is already waiting: join it stopped rather than running underneath it.
+    if (bStopRequested.load(std::memory_order_relaxed) && StopOwner != std::this_thread::get_id())
+    {
+        Park(Lock, *M);
+    }
+}
+
+void GcUnregisterMutator()
+{
+    FMutatorState* M = ThisMutator;
+    if (!M)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        std::erase(Mutators, M);
+        Cv.notify_all();
+    }
+    ThisMutator = nullptr;
+    delete M;
+}
+
+void GcEnterUnsafeRegion()
+{
+    if (ThisMutator)
+    {
+        ++ThisMutator->UnsafeDepth;
+    }
+}
+
+void GcLeaveUnsafeRegion()
+{
+    if (ThisMutator && --ThisMutator->UnsafeDepth == 0)
+    {
+        // Take the safepoint that was deferred inside the region.
+        GcSafepoint();
+    }
+}
+
+void GcEnterSafeRegion()
+{
+    FMutatorState* M = ThisMutator;
+    if (!M)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (M->SafeDepth == 0)
+    {
+        CaptureStoppedState(*M);
+    }
+    ++M->SafeDepth;
+    Cv.notify_all();
+}
+
+void GcLeaveSafeRegion()
+{
+    FMutatorState* M = ThisMutator;
+    if (!M)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> Lock(Mutex);
+    if (--M->SafeDepth == 0 && StopOwner != std::this_thread::get_id())
+    {
+        // The world is stopped: stay out of the heap until it resumes.
+        Cv.wait(Lock, [] { return !bStopRequested.load(std::memory_order_relaxed); });
+    }
+}
+
+FGcStopStats GcStopTheWorld()
+{
+    const std::thread::id Self = std::this_thread::get_id();
+    
+    std::unique_lock<std::mutex> Lock(Mutex);
+    if (StopDepth > 0 && StopOwner == Self)
+    {
+        ++StopDepth;
+        return {};
+    }
+
+    // Another thread is stopping the world. Counts as parked meanwhile so the two cannot wait on each other.
+    while (StopDepth > 0)
+    {
+        if (ThisMutator)
+        {
+            Park(Lock, *ThisMutator);
+        }
+        else
+        {
+            Cv.wait(Lock, [] { return StopDepth == 0; });
+        }
+    }
+
+    StopOwner = Self;
+    StopDepth = 1;
+    ++StopId;
+    StopRequestedAt = Clock::now();
+    bStopRequested.store(true, std::memory_order_relaxed);
+
+    Cv.wait(Lock, []
+    {
+        return std::all_of(Mutators.begin(), Mutators.end(), [](const FMutatorState* M)
+        {
+            return M == ThisMutator || IsStopped(*M);
+        });
+    });
+
+    FGcStopStats Stats;
+    Stats.TimeToSafepointMs = std::chrono::duration<double, std::milli>(Clock::now() - StopRequestedAt).count();
+    for (const FMutatorState* M : Mutators)
+    {
+        if (M == ThisMutator || M->ParkedStopId != StopId)
+        {
+            continue;
+        }
+        
+        ++Stats.NumMutators;
+        if (M->LastTtspMs >= Stats.SlowestMs)
+        {
+            Stats.SlowestMs = M->LastTtspMs;
+            Stats.SlowestMutator = M->Name;
+        }
+    }
+    return Stats;
+}
+
+void GcResumeTheWorld()
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (StopDepth == 0 || --StopDepth > 0)
+    {
+        return;
+    }
+
+    StopOwner = std::thread::id();
+    bStopRequested.store(false, std::memory_order_relaxed);
+    Cv.notify_all();
+}
+
+void GcListMutators()
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+    std::cout << "[Safepoint] mutators=" << Mutators.size() << "\n";
+    for (const FMutatorState* M : Mutators)
+    {
+        const char* State = M->bParked ? "parked" : (M->SafeDepth > 0 ? "safe" : "running");
+        std::cout << " - " << M->Name << ": " << State << ", ttsp last=" << M->LastTtspMs << " ms, max="
+                  << M->MaxTtspMs << " ms\n";
+    }
+}
+
+#if defined(__linux__)
+__attribute__((noinline)) bool GcVisitThreadStacks(const std::function<void(const void* Low, const void* High)>& Visit)
+{
+    // Spill this thread's registers into a local, so they are inside the scanned range below.
+    ucontext_t Context;
+    getcontext(&Context);
+    
+    thread_local const void* ThisStackHigh = GetThreadStackHigh();
+    
+    struct FRange
+    {
+        const void* Low;
+        const void* High;
+    };
+    std::vector<FRange> Ranges;
+    Ranges.push_back({&Context, &Context + 1});
+    Ranges.push_back({__builtin_frame_address(0), ThisStackHigh});
+
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        for (const FMutatorState* M : Mutators)
+        {
+            if (M == ThisMutator || !IsStopped(*M) || !M->StackHigh)
+            {
+                continue;
+            }
+            Ranges.push_back({&M->StoppedContext, &M->StoppedContext + 1});
+            Ranges.push_back({M->StoppedSp, M->StackHigh});
+        }
+    }
+
+    for (const FRange& Range : Ranges)
+    {
+        if (Range.Low && Range.High && Range.Low < Range.High)
+        {
+            Visit(Range.Low, Range.High);
+        }
+    }
+    return true;
+}
+#else
+bool GcVisitThreadStacks(const std::function<void(const void* Low, const void* High)>&)
+{
+    return false;
+}
+#endif
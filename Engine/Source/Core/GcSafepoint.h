@@ -0,0 +1,104 @@
+﻿#pragma once
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+// Mutator safepoints.
+// A thread that touches QObjects concurrently with the game thread registers as a mutator and calls GcSafepoint()
+// at points where every object it uses is reachable from reflected references. When a collection starts, the
+// collector raises a flag and waits until each registered mutator has parked in GcSafepoint() (or sits in a
+// GC-safe region), runs with the world stopped, then releases them.
+//
+// GC-unsafe region: safepoints inside are deferred until the outermost region is left (for multi-step edits
+// that must not be observed half done).
+// GC-safe region: the thread promises not to touch QObjects (blocking waits, I/O) and counts as stopped.
+
+namespace GcSafepointDetail
+{
+    extern std::atomic<bool> bStopRequested;
+    void SafepointSlow();
+}
+
+void GcRegisterMutator(const std::string& Name);
+void GcUnregisterMutator();
+
+// Cheap poll: one relaxed load while no collection is pending.
+inline void GcSafepoint()
+{
+    if (GcSafepointDetail::bStopRequested.load(std::memory_order_relaxed))
+    {
+        GcSafepointDetail::SafepointSlow();
+    }
+}
+
+void GcEnterUnsafeRegion();
+void GcLeaveUnsafeRegion();
+
+void GcEnterSafeRegion();
+void GcLeaveSafeRegion();
+
+// Collector side. Stops are reentrant on the stopping thread; only the outermost pair waits and releases.
+struct FGcStopStats
+{
+    size_t NumMutators = 0;         // mutators that had to be waited for
+    double TimeToSafepointMs = 0.0; // request -> last mutator parked
+    std::string SlowestMutator;
+    double SlowestMs = 0.0;
+};
+
+FGcStopStats GcStopTheWorld();
+void GcResumeTheWorld();
+
+// Prints every registered mutator with its last and worst time-to-safepoint.
+void GcListMutators();
+
+// Conservative stack scanning (Linux only; returns false elsewhere). Must be called by the thread that stopped the
+// world. Visits the live stack of the calling thread and of every stopped mutator, plus their spilled registers, as
+// [Low, High) byte ranges. A mutator's stack is captured when it parks or enters a safe region.
+bool GcVisitThreadStacks(const std::function<void(const void* Low, const void* High)>& Visit);
+
+class FGcMutatorScope
+{
+public:
+    explicit FGcMutatorScope(const std::string& Name) { GcRegisterMutator(Name); }
+    ~FGcMutatorScope() { GcUnregisterMutator(); }
+
+    FGcMutatorScope(const FGcMutatorScope&) = delete;
+    FGcMutatorScope& operator=(const FGcMutatorScope&) = delete;
+};
+
+class FGcUnsafeRegionScope
+{
+public:
+    FGcUnsafeRegionScope() { GcEnterUnsafeRegion(); }
+    ~FGcUnsafeRegionScope() { GcLeaveUnsafeRegion(); }
+
+    FGcUnsafeRegionScope(const FGcUnsafeRegionScope&) = delete;
+    FGcUnsafeRegionScope& operator=(const FGcUnsafeRegionScope&) = delete;
+};
+
+class FGcSafeRegionScope
+{
+public:
+    FGcSafeRegionScope() { GcEnterSafeRegion(); }
+    ~FGcSafeRegionScope() { GcLeaveSafeRegion(); }
+
+    FGcSafeRegionScope(const FGcSafeRegionScope&) = delete;
+    FGcSafeRegionScope& operator=(const FGcSafeRegionScope&) = delete;
+};
+
+class FGcStopTheWorldScope
+{
+public:
+    FGcStopTheWorldScope() : Stats(GcStopTheWorld()) {}
+    ~FGcStopTheWorldScope() { GcResumeTheWorld(); }
+
+    FGcStopTheWorldScope(const FGcStopTheWorldScope&) = delete;
+    FGcStopTheWorldScope& operator=(const FGcStopTheWorldScope&) = delete;
+
+    const FGcStopStats& GetStats() const { return Stats; }
+
+private:
+    FGcStopStats Stats;
+};
@@ -0,0 +1,479 @@
+﻿#include "ObjectAllocator.h"
+
+#include <bit>
+#include <iostream>
+#include <new>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+// --- Platform pages ---
+
+unsigned char* FObjectAllocator::ReservePage()
+{
+#if defined(_WIN32)
+    // Allocation granularity on Windows is 64KB, so the base is already page aligned.
+    void* Mem = VirtualAlloc(nullptr, PageSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (!Mem)
+    {
+        throw std::bad_alloc();
+    }
+    return static_cast<unsigned char*>(Mem);
+#else
+    // Over-map by one page and trim so the page is PageSize aligned (the page map relies on it).
+    void* Raw = mmap(nullptr, PageSize * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (Raw == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+
+    const uintptr_t Start = reinterpret_cast<uintptr_t>(Raw);
+    const uintptr_t Aligned = (Start + PageSize - 1) & ~(uintptr_t(PageSize) - 1);
+    if (Aligned > Start)
+    {
+        munmap(Raw, Aligned - Start);
+    }
+
+    const uintptr_t Tail = Aligned + PageSize;
+    const uintptr_t End = Start + PageSize * 2;
+    if (End > Tail)
+    {
+        munmap(reinterpret_cast<void*>(Tail), End - Tail);
+    }
+    return reinterpret_cast<unsigned char*>(Aligned);
+#endif
+}
+
+void FObjectAllocator::ReleasePage(unsigned char* Base)
+{
+#if defined(_WIN32)
+    VirtualFree(Base, 0, MEM_RELEASE);
+#else
+    munmap(Base, PageSize);
+#endif
+}
+
+void FObjectAllocator::DecommitPage(unsigned char* Base)
+{
+#if defined(_WIN32)
+    VirtualFree(Base, PageSize, MEM_DECOMMIT);
+#else
+    madvise(Base, PageSize, MADV_DONTNEED);
+#endif
+}
+
+void FObjectAllocator::RecommitPage(unsigned char* Base)
+{
+#if defined(_WIN32)
+    if (!VirtualAlloc(Base, PageSize, MEM_COMMIT, PAGE_READWRITE))
+    {
+        throw std::bad_alloc();
+    }
+#else
+    // MADV_DONTNEED pages are refilled with zeros on first touch.
+    (void)Base;
+#endif
+}
+
+// --- Allocator ---
+
+FObjectAllocator::~FObjectAllocator()
+{
+    for (const std::unique_ptr<FPage>& Page : Pages)
+    {
+        if (Page->Shape.load(std::memory_order_relaxed) != 0)
+        {
+            ReleasePage(Page->Base);
+        }
+    }
+}
+
+namespace
+{
+    size_t HashPageKey(uintptr_t Key)
+    {
+        return static_cast<size_t>((uint64_t(Key) * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+}
+
+FObjectAllocator::FPage* FObjectAllocator::FindPage(const void* Mem) const
+{
+    const FPageTable* Table = PageMap.load(std::memory_order_acquire);
+    if (!Table)
+    {
+        return nullptr;
+    }
+
+    const uintptr_t Key = (reinterpret_cast<uintptr_t>(Mem) >> PageShift) + 1;
+    for (size_t Slot = HashPageKey(Key) & Table->Mask;; Slot = (Slot + 1) & Table->Mask)
+    {
+        const uintptr_t Found = Table->Keys[Slot].load(std::memory_order_acquire);
+        if (Found == Key)
+        {
+            return Table->Pages[Slot].load(std::memory_order_relaxed);
+        }
+        if (Found == 0)
+        {
+            return nullptr;
+        }
+    }
+}
+
+void FObjectAllocator::InsertPage(FPage* Page)
+{
+    // Kept at most half full, so every probe ends on an empty slot.
+    FPageTable* Table = PageMap.load(std::memory_order_relaxed);
+    if (!Table || (Pages.size() + 1) * 2 > Table->Mask + 1)
+    {
+        auto Grown = std::make_unique<FPageTable>(Table ? (Table->Mask + 1) * 2 : 256);
+        for (const std::unique_ptr<FPage>& Existing : Pages)
+        {
+            if (Existing.get() == Page)
+            {
+                continue;
+            }
+            const uintptr_t Key = (reinterpret_cast<uintptr_t>(Existing->Base) >> PageShift) + 1;
+            size_t Slot = HashPageKey(Key) & Grown->Mask;
+            while (Grown->Keys[Slot].load(std::memory_order_relaxed) != 0)
+            {
+                Slot = (Slot + 1) & Grown->Mask;
+            }
+            Grown->Pages[Slot].store(Existing.get(), std::memory_order_relaxed);
+            Grown->Keys[Slot].store(Key, std::memory_order_relaxed);
+        }
+
+        Table = Grown.get();
+        PageTables.push_back(std::move(Grown));
+        PageMap.store(Table, std::memory_order_release);
+    }
+
+    // The page pointer is stored before the key is published.
+    const uintptr_t Key = (reinterpret_cast<uintptr_t>(Page->Base) >> PageShift) + 1;
+    size_t Slot = HashPageKey(Key) & Table->Mask;
+    while (Table->Keys[Slot].load(std::memory_order_relaxed) != 0)
+    {
+        Slot = (Slot + 1) & Table->Mask;
+    }
+    Table->Pages[Slot].store(Page, std::memory_order_relaxed);
+    Table->Keys[Slot].store(Key, std::memory_order_release);
+}
+
+FObjectAllocator::FPage* FObjectAllocator::NewPage(FSizeClass& Class)
+{
+    FPage* Page = nullptr;
+    if (!Class.Empty.empty())
+    {
+        Page = Class.Empty.back();
+        Class.Empty.pop_back();
+        RecommitPage(Page->Base);
+        Page->bCommitted = true;
+    }
+    else
+    {
+        // A released page's metadata is reused when the OS hands the same range back.
+        unsigned char* Base = ReservePage();
+        Page = FindPage(Base);
+        if (!Page)
+        {
+            Pages.push_back(std::make_unique<FPage>());
+            Page = Pages.back().get();
+            Page->Base = Base;
+            Page->bCommitted = true;
+            InsertPage(Page);
+        }
+        
+        Page->Class = &Class;
+        Page->SlotSize = Class.SlotSize;
+        Page->NumSlots = static_cast<uint32_t>(PageSize / Class.SlotSize);
+        Page->bCommitted = true;
+        Page->Shape.store(uint64_t(Page->SlotSize) << 32 | Page->NumSlots, std::memory_order_release);
+    }
+
+    // Bits past NumSlots are pre-set so the free-slot scan never has to mask the last word.
+    const size_t Words = (Page->NumSlots + 63) / 64;
+    Page->AllocBits.assign(Words, 0);
+    for (std::atomic<uint64_t>& Live : Page->LiveBits)
+    {
+        Live.store(0, std::memory_order_relaxed);
+    }
+    if (const uint32_t Tail = Page->NumSlots % 64)
+    {
+        Page->AllocBits.back() = ~uint64_t(0) << Tail;
+    }
+    Page->NumUsed = 0;
+    Page->FreeWordHint = 0;
+
+    Page->PartialIndex = static_cast<int32_t>(Class.Partial.size());
+    Class.Partial.push_back(Page);
+    return Page;
+}
+
+void FObjectAllocator::RemovePartial(FPage* Page)
+{
+    if (Page->PartialIndex < 0)
+    {
+        return;
+    }
+
+    std::vector<FPage*>& Partial = Page->Class->Partial;
+    FPage* Last = Partial.back();
+    Partial[Page->PartialIndex] = Last;
+    Last->PartialIndex = Page->PartialIndex;
+    Partial.pop_back();
+    Page->PartialIndex = -1;
+}
+
+void* FObjectAllocator::Allocate(size_t Size)
+{
+    if (Size == 0)
+    {
+        Size = 1;
+    }
+
+    if (Size > MaxSlabSize)
+    {
+        ++LargeAllocs;
+        return ::operator new(Size);
+    }
+
+    FSizeClass& Class = *ClassFor(Size);
+    return AllocateFromPage(Class.Partial.empty() ? NewPage(Class) : Class.Partial.back());
+}
+
+void* FObjectAllocator::AllocateCompact(size_t Size)
+{
+    if (Size == 0)
+    {
+        Size = 1;
+    }
+
+    if (Size > MaxSlabSize)
+    {
+        return nullptr;
+    }
+
+    FSizeClass& Class = *ClassFor(Size);
+    if (!Class.CompactPage || Class.CompactPage->NumUsed == Class.CompactPage->NumSlots)
+    {
+        Class.CompactPage = NewPage(Class);
+    }
+    return AllocateFromPage(Class.CompactPage);
+}
+
+void FObjectAllocator::EndCompaction()
+{
+    for (FSizeClass& Class : Classes)
+    {
+        Class.CompactPage = nullptr;
+    }
+}
+
+FObjectAllocator::FSizeClass* FObjectAllocator::ClassFor(size_t Size)
+{
+    FSizeClass& Class = Classes[(Size + Granularity - 1) / Granularity - 1];
+    if (Class.SlotSize == 0)
+    {
+        Class.SlotSize = static_cast<uint32_t>((Size + Granularity - 1) / Granularity * Granularity);
+    }
+    return &Class;
+}
+
+void* FObjectAllocator::AllocateFromPage(FPage* Page)
+{
+    for (size_t W = Page->FreeWordHint; W < Page->AllocBits.size(); ++W)
+    {
+        const uint64_t FreeBits = ~Page->AllocBits[W];
+        if (!FreeBits)
+        {
+            continue;
+        }
+
+        const size_t Bit = static_cast<size_t>(std::countr_zero(FreeBits));
+        Page->AllocBits[W] |= uint64_t(1) << Bit;
+        Page->FreeWordHint = static_cast<uint32_t>(W);
+
+        if (++Page->NumUsed == Page->NumSlots)
+        {
+            RemovePartial(Page);
+        }
+        return Page->Base + (W * 64 + Bit) * Page->SlotSize;
+    }
+
+    // Unreachable: a partial page always has a free slot at or after FreeWordHint.
+    throw std::bad_alloc();
+}
+
+void FObjectAllocator::Free(void* Mem, size_t Size)
+{
+    if (!Mem)
+    {
+        return;
+    }
+
+    if (Size == 0)
+    {
+        Size = 1;
+    }
+
+    if (Size > MaxSlabSize)
+    {
+        --LargeAllocs;
+        ::operator delete(Mem);
+        return;
+    }
+
+    FPage* Page = FindPage(Mem);
+    if (!Page)
+    {
+        return;
+    }
+
+    const size_t Slot = static_cast<size_t>(static_cast<unsigned char*>(Mem) - Page->Base) / Page->SlotSize;
+    const size_t W = Slot / 64;
+    const uint64_t Mask = uint64_t(1) << (Slot % 64);
+    Page->AllocBits[W] &= ~Mask;
+    Page->LiveBits[W].fetch_and(~Mask, std::memory_order_release);
+
+    FSizeClass& Class = *Page->Class;
+    if (Page->NumUsed == Page->NumSlots)
+    {
+        Page->PartialIndex = static_cast<int32_t>(Class.Partial.size());
+        Class.Partial.push_back(Page);
+    }
+
+    --Page->NumUsed;
+    if (W < Page->FreeWordHint)
+    {
+        Page->FreeWordHint = static_cast<uint32_t>(W);
+    }
+
+    // Empty page: give the memory back to the OS but keep the address range for reuse.
+    // The last partial page of a class stays committed so alloc/free ping-pong does not syscall.
+    if (Page->NumUsed == 0 && Class.Partial.size() > 1)
+    {
+        RemovePartial(Page);
+        DecommitPage(Page->Base);
+        Page->bCommitted = false;
+        Class.Empty.push_back(Page);
+    }
+}
+
+void FObjectAllocator::SetLive(const void* Mem, bool bLive)
+{
+    FPage* Page = FindPage(Mem);
+    if (!Page)
+    {
+        return;
+    }
+
+    const size_t Slot = static_cast<size_t>(static_cast<const unsigned char*>(Mem) - Page->Base) / Page->SlotSize;
+    const uint64_t Mask = uint64_t(1) << (Slot % 64);
+    if (bLive)
+    {
+        Page->LiveBits[Slot / 64].fetch_or(Mask, std::memory_order_release);
+    }
+    else
+    {
+        Page->LiveBits[Slot / 64].fetch_and(~Mask, std::memory_order_release);
+    }
+}
+
+bool FObjectAllocator::IsLiveObject(const void* Mem) const
+{
+    // Lock-free: only Shape and the live bits are read, and the page base follows from the address. A decommitted
+    // page has no live bits set.
+    const FPage* Page = FindPage(Mem);
+    const uint64_t Shape = Page ? Page->Shape.load(std::memory_order_acquire) : 0;
+    if (Shape == 0)
+    {
+        return false;
+    }
+
+    const size_t SlotSize = static_cast<size_t>(Shape >> 32);
+    const size_t NumSlots = static_cast<size_t>(Shape & 0xFFFFFFFFu);
+    const size_t Offset = static_cast<size_t>(reinterpret_cast<uintptr_t>(Mem) & (PageSize - 1));
+    if (Offset % SlotSize != 0)
+    {
+        return false;
+    }
+
+    const size_t Slot = Offset / SlotSize;
+    return Slot < NumSlots
+        && (Page->LiveBits[Slot / 64].load(std::memory_order_acquire) & (uint64_t(1) << (Slot % 64))) != 0;
+}
+
+size_t FObjectAllocator::ReleaseEmptyPages()
+{
+    size_t Bytes = 0;
+    // The metadata stays in the page table (readers may hold it); Shape 0 marks the range as no longer ours.
+    auto Release = [&](FPage* Page)
+    {
+        Page->Shape.store(0, std::memory_order_release);
+        ReleasePage(Page->Base);
+        Bytes += PageSize;
+        Page->bCommitted = false;
+    };
+
+    for (FSizeClass& Class : Classes)
+    {
+        for (FPage* Page : Class.Empty)
+        {
+            Release(Page);
+        }
+        Class.Empty.clear();
+
+        for (size_t i = 0; i < Class.Partial.size(); )
+        {
+            FPage* Page = Class.Partial[i];
+            if (Page->NumUsed == 0)
+            {
+                RemovePartial(Page);
+                Release(Page);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+    return Bytes;
+}
+
+FObjectAllocator::FStats FObjectAllocator::GetStats() const
+{
+    FStats Stats;
+    Stats.LargeAllocs = LargeAllocs;
+    for (const std::unique_ptr<FPage>& Page : Pages)
+    {
+        if (Page->Shape.load(std::memory_order_relaxed) == 0)
+        {
+            continue;
+        }
+        ++Stats.NumPages;
+        if (!Page->bCommitted)
+        {
+            ++Stats.NumEmptyPages;
+            continue;
+        }
+        Stats.CommittedBytes += PageSize;
+        Stats.UsedBytes += size_t(Page->NumUsed) * Page->SlotSize;
+    }
+    return Stats;
+}
+
+void FObjectAllocator::PrintStats() const
+{
+    const FStats Stats = GetStats();
+    std::cout << "[Slab] pages=" << Stats.NumPages << " (decommitted=" << Stats.NumEmptyPages << ")"
+              << ", committed=" << Stats.CommittedBytes << "B, used=" << Stats.UsedBytes << "B"
+              << ", large=" << Stats.LargeAllocs << "\n";
+}
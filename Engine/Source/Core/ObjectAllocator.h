@@ -0,0 +1,126 @@
+﻿#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Slab allocator backing managed objects.
+// Objects are grouped by size class (TypeInfo::size rounded up to 16 bytes) into 64KB pages, so objects of the same
+// type sit next to each other. Page metadata lives outside the pages; a page map keyed by address >> PageShift gives
+// an O(1) "is this a managed object" check. Sizes above MaxSlabSize fall back to the system allocator.
+// Every call needs external synchronization except OwnsAddress and IsLiveObject, which are lock-free and may run
+// concurrently with the rest.
+class FObjectAllocator
+{
+public:
+    static constexpr size_t PageShift = 16;
+    static constexpr size_t PageSize = size_t(1) << PageShift; // 64KB
+    static constexpr size_t Granularity = 16;
+    static constexpr size_t MaxSlabSize = 4096;
+
+    FObjectAllocator() = default;
+    ~FObjectAllocator();
+
+    FObjectAllocator(const FObjectAllocator&) = delete;
+    FObjectAllocator& operator=(const FObjectAllocator&) = delete;
+
+    void* Allocate(size_t Size);
+    void Free(void* Mem, size_t Size);
+
+    // Compaction: allocates only from pages opened during the current compaction, so survivors end up packed
+    // into fresh pages. EndCompaction() returns to normal allocation.
+    void* AllocateCompact(size_t Size);
+    void EndCompaction();
+
+    // Live bit: set while a constructed object occupies the slot (a pooled free block is allocated but not live).
+    void SetLive(const void* Mem, bool bLive);
+
+    // True for an allocated slot start whose live bit is set. Returns false for anything outside the slab pages.
+    bool IsLiveObject(const void* Mem) const;
+    bool OwnsAddress(const void* Mem) const
+    {
+        const FPage* Page = FindPage(Mem);
+        return Page && Page->Shape.load(std::memory_order_acquire) != 0;
+    }
+
+    // Unmaps pages that have no allocated slot. Returns the number of bytes released.
+    size_t ReleaseEmptyPages();
+
+    struct FStats
+    {
+        size_t NumPages = 0;
+        size_t NumEmptyPages = 0;   // decommitted, kept for reuse
+        size_t CommittedBytes = 0;
+        size_t UsedBytes = 0;       // allocated slots * slot size
+        size_t LargeAllocs = 0;     // live allocations served by the system allocator
+    };
+    FStats GetStats() const;
+    void PrintStats() const;
+
+private:
+    struct FSizeClass;
+
+    static constexpr size_t MaxBitWords = PageSize / Granularity / 64;
+
+    struct FPage
+    {
+        unsigned char* Base = nullptr;
+        FSizeClass* Class = nullptr;
+        uint32_t SlotSize = 0;
+        uint32_t NumSlots = 0;
+        uint32_t NumUsed = 0;
+        uint32_t FreeWordHint = 0;
+        int32_t PartialIndex = -1;      // position in Class->Partial, -1 when full or empty
+        bool bCommitted = true;
+        std::vector<uint64_t> AllocBits;
+
+        // Read by the lock-free queries. Shape is SlotSize << 32 | NumSlots while the address range is mapped and
+        // 0 once the page is released; a released page keeps its metadata for when the OS hands the range back.
+        std::atomic<uint64_t> Shape { 0 };
+        std::atomic<uint64_t> LiveBits[MaxBitWords] {};
+    };
+
+    // Append-only open addressing from page key (address >> PageShift) to page. Only inserted into under the
+    // caller's lock; it grows by publishing a doubled copy, and replaced tables stay alive for lock-free readers
+    // that may still be probing them.
+    struct FPageTable
+    {
+        explicit FPageTable(size_t NumSlots)
+            : Keys(new std::atomic<uintptr_t>[NumSlots]())
+            , Pages(new std::atomic<FPage*>[NumSlots]())
+            , Mask(NumSlots - 1)
+        {
+        }
+
+        std::unique_ptr<std::atomic<uintptr_t>[]> Keys;    // key + 1, 0 = empty
+        std::unique_ptr<std::atomic<FPage*>[]> Pages;
+        size_t Mask = 0;
+    };
+
+    struct FSizeClass
+    {
+        uint32_t SlotSize = 0;
+        std::vector<FPage*> Partial;    // pages with at least one free slot
+        std::vector<FPage*> Empty;      // decommitted pages
+        FPage* CompactPage = nullptr;   // current target page while compacting
+    };
+
+    FPage* FindPage(const void* Mem) const;
+    void InsertPage(FPage* Page);
+    FSizeClass* ClassFor(size_t Size);
+    void* AllocateFromPage(FPage* Page);
+    FPage* NewPage(FSizeClass& Class);
+    void RemovePartial(FPage* Page);
+
+    static unsigned char* ReservePage();
+    static void ReleasePage(unsigned char* Base);
+    static void DecommitPage(unsigned char* Base);
+    static void RecommitPage(unsigned char* Base);
+
+    std::vector<FSizeClass> Classes = std::vector<FSizeClass>(MaxSlabSize / Granularity);
+    std::vector<std::unique_ptr<FPage>> Pages;     // every page ever created, released ones included
+    std::vector<std::unique_ptr<FPageTable>> PageTables;
+    std::atomic<FPageTable*> PageMap { nullptr };
+    size_t LargeAllocs = 0;
+};
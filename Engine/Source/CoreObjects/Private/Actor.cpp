@@ -1 +1,9 @@
 ﻿#include "Actor.h"
+
+#include "GarbageCollector.h"
+
+void QActor::SetOwner(QObject* InOwner)
+{
+    GarbageCollector::Get().NoteReferenceWrite(this, InOwner);
+    Owner = InOwner;
+}
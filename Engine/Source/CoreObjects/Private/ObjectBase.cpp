@@ -0,0 +1,123 @@
+﻿#include "ObjectBase.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#include "qmeta_runtime.h"
+
+static_assert(sizeof(QObjectBase) == sizeof(void*) + sizeof(uint64_t), "QObjectBase header should stay one packed word");
+
+namespace
+{
+    // Explicit names are rare (most objects keep their generated name), so they live outside the header.
+    struct FExplicitNames
+    {
+        std::mutex Mutex;
+        std::unordered_map<uint64_t, FName> ById;
+        std::unordered_map<FName, uint64_t> ByName;
+    };
+
+    FExplicitNames& GetExplicitNames()
+    {
+        static FExplicitNames Names;
+        return Names;
+    }
+
+    void RemoveExplicitName(FExplicitNames& Names, const uint64_t Id)
+    {
+        auto It = Names.ById.find(Id);
+        if (It == Names.ById.end())
+        {
+            return;
+        }
+        
+        if (auto NameIt = Names.ByName.find(It->second); NameIt != Names.ByName.end() && NameIt->second == Id)
+        {
+            Names.ByName.erase(NameIt);
+        }
+        Names.ById.erase(It);
+    }
+}
+
+QObjectBase::~QObjectBase()
+{
+    if (Flags & OF_ExplicitName)
+    {
+        FExplicitNames& Names = GetExplicitNames();
+        std::lock_guard<std::mutex> Lock(Names.Mutex);
+        RemoveExplicitName(Names, ObjectId);
+    }
+}
+
+QObjectBase::QObjectBase(const QObjectBase& Other)
+    : ObjectId(Other.ObjectId)
+    , TypeIndex(Other.TypeIndex)
+    , Flags(Other.Flags & ~OF_ExplicitName)
+{
+}
+
+QObjectBase::QObjectBase(QObjectBase&& Other) noexcept
+    : ObjectId(Other.ObjectId)
+    , TypeIndex(Other.TypeIndex)
+    , Flags(Other.Flags)
+{
+    // The source is destroyed right after a relocation; it must not drop the name this object now owns.
+    Other.Flags &= ~OF_ExplicitName;
+}
+
+void QObjectBase::InitObjectHeader(const uint64_t Id, const uint16_t InTypeIndex)
+{
+    ObjectId = Id;
+    TypeIndex = InTypeIndex;
+}
+
+FName QObjectBase::GetDebugFName() const
+{
+    if (Flags & OF_ExplicitName)
+    {
+        FExplicitNames& Names = GetExplicitNames();
+        std::lock_guard<std::mutex> Lock(Names.Mutex);
+        auto It = Names.ById.find(ObjectId);
+        return It == Names.ById.end() ? FName() : It->second;
+    }
+
+    const qmeta::TypeInfo* Ti = qmeta::GetRegistry().find_by_index(GetTypeIndex());
+    if (!Ti)
+    {
+        return FName();
+    }
+
+    // ClassName_ID: the interned type name with the id as number suffix.
+    return FName(Ti->name_id, ObjectId + 1);
+}
+
+std::string QObjectBase::GetDebugName() const
+{
+    const FName Name = GetDebugFName();
+    return Name.IsNone() ? std::string() : Name.ToString();
+}
+
+void QObjectBase::SetDebugName(const FName name)
+{
+    FExplicitNames& Names = GetExplicitNames();
+    std::lock_guard<std::mutex> Lock(Names.Mutex);
+    RemoveExplicitName(Names, ObjectId);
+    
+    if (name.IsNone())
+    {
+        Flags &= ~OF_ExplicitName;
+        return;
+    }
+
+    Names.ById[ObjectId] = name;
+    Names.ByName[name] = ObjectId;
+    Flags |= OF_ExplicitName;
+}
+
+uint64_t QObjectBase::FindIdByExplicitName(const FName Name)
+{
+    FExplicitNames& Names = GetExplicitNames();
+    std::lock_guard<std::mutex> Lock(Names.Mutex);
+    auto It = Names.ByName.find(Name);
+    return It == Names.ByName.end() ? 0 : It->second;
+}
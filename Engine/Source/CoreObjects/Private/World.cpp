@@ -12,6 +12,7 @@ void QWorld::AddObject(const std::string& ObjName)
 {
     GarbageCollector& GC = GarbageCollector::Get();
     QObject* Obj = GC.FindByDebugName(ObjName);
+    GC.NoteReferenceWrite(this, Obj);
     Objects.push_back(Obj);
 }
 
@@ -18,5 +18,5 @@ public:
     QObject* GetOwner() { return Owner; }
     
     QFUNCTION()
-    void SetOwner(QObject* InOwner) { Owner = InOwner; }
+    void SetOwner(QObject* InOwner);
 };
\ No newline at end of file
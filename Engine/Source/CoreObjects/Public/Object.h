@@ -1,11 +1,39 @@
 ﻿#pragma once
 
+#include <unordered_map>
+
 #include "ObjectBase.h"
 
 class QObject : public QObjectBase
 {
 public:
+    QObject() = default;
     ~QObject() override = default;
+    
+    QObject(const QObject&) = default;
+    QObject(QObject&&) noexcept = default;
+    QObject& operator=(const QObject&) = default;
+    QObject& operator=(QObject&&) noexcept = default;
+
+    // Called on every live object after a GC compaction. Reflected properties are already rewritten;
+    // override only to remap QObject* held outside reflection (Relocated: old address -> new address).
+    virtual void PostGcCompact(const std::unordered_map<QObject*, QObject*>& /*Relocated*/) {}
+
+    // Two-phase destruction. A swept object is unlinked from the GC and BeginDestroy() runs inside the pause, so it
+    // should only start (possibly asynchronous) teardown. The object then waits in the GC's pending-kill list, polled
+    // from Tick, until IsReadyForFinishDestroy() returns true; FinishDestroy() runs right before the destructor.
+    // Other QObjects may already be destroyed by then: do not follow reflected references after BeginDestroy().
+    virtual void BeginDestroy() {}
+    virtual bool IsReadyForFinishDestroy() { return true; }
+    virtual void FinishDestroy() {}
+
+    // The GC keeps this object alive but does not trace its references (header flag OF_GcIgnoredSelfAndBelow).
+    bool IsGcIgnoredSelfAndBelow() const { return HasAnyFlags(OF_GcIgnoredSelfAndBelow); }
+    void SetGcIgnoredSelfAndBelow(const bool bIgnored) { bIgnored ? SetFlags(OF_GcIgnoredSelfAndBelow) : ClearFlags(OF_GcIgnoredSelfAndBelow); }
+
+    // True once the GC has swept the object and it is waiting for FinishDestroy().
+    bool IsPendingKill() const { return HasAnyFlags(OF_PendingKill); }
 
-    bool bGcIgnoredSelfAndBelow = false;
+    // True for objects created with NewTransientObject (frame arena, never collected).
+    bool IsTransient() const { return HasAnyFlags(OF_Transient); }
 };
@@ -1,20 +1,59 @@
 ﻿#pragma once
+#include <cstdint>
 #include <string>
 
+#include "Name.h"
+
+enum EObjectFlags : uint8_t
+{
+    OF_None                     = 0,
+    OF_GcIgnoredSelfAndBelow    = 1 << 0,   // GC does not trace references held by this object
+    OF_ExplicitName             = 1 << 1,   // debug name was set with SetDebugName (stored out of line)
+    OF_Permanent                = 1 << 2,   // lives in the GC's permanent region (registered there or MakePermanent)
+    OF_PendingKill              = 1 << 3,   // swept; waiting in the GC's pending-kill list
+    OF_Transient                = 1 << 4,   // lives in the frame arena, not managed by the GC
+};
+
 // Minimal base for reflection/GC-ready objects.
+// The header is one packed word next to the vtable pointer: a 40-bit object id (also the slot in the GC's id index),
+// a 16-bit index into the type registry and 8 flag bits. The debug name is derived from type and id ("QActor_12")
+// unless one was set explicitly.
 class QObjectBase
 {
 public:
+    static constexpr uint64_t MaxObjectId = (uint64_t(1) << 40) - 1;
+    static constexpr uint16_t InvalidTypeIndex = 0xFFFF;
+
     QObjectBase() = default;
-    virtual ~QObjectBase() = default;
+    virtual ~QObjectBase();
+
+    // A moved-to object takes over the identity (GC compaction relocates by move), a copy gets the same id and type
+    // but not the explicit name. Assignment copies state, never identity, so the header is left alone.
+    QObjectBase(const QObjectBase& Other);
+    QObjectBase(QObjectBase&& Other) noexcept;
+    QObjectBase& operator=(const QObjectBase&) { return *this; }
+    QObjectBase& operator=(QObjectBase&&) noexcept { return *this; }
 
     uint64_t GetObjectId() const { return ObjectId; }
-    void SetObjectId(const uint64_t Id) { ObjectId = Id; }
+    uint16_t GetTypeIndex() const { return static_cast<uint16_t>(TypeIndex); }
+
+    // Set once by NewObject.
+    void InitObjectHeader(uint64_t Id, uint16_t InTypeIndex);
+
+    bool HasAnyFlags(const uint8_t Mask) const { return (Flags & Mask) != 0; }
+    void SetFlags(const uint8_t Mask) { Flags |= Mask; }
+    void ClearFlags(const uint8_t Mask) { Flags &= ~Mask; }
+
+    FName GetDebugFName() const;
+    std::string GetDebugName() const;
+    void SetDebugName(const std::string& name) { SetDebugName(FName(name)); }
+    void SetDebugName(FName name);
+
+    // Id of the live object whose explicit debug name is Name, 0 if none.
+    static uint64_t FindIdByExplicitName(FName Name);
 
-    const std::string& GetDebugName() const { return DebugName; }
-    void SetDebugName(const std::string& name) { DebugName = name; }
-    
 private:
-    uint64_t ObjectId = 0;
-    std::string DebugName;
+    uint64_t ObjectId : 40 = 0;
+    uint64_t TypeIndex : 16 = InvalidTypeIndex;
+    uint64_t Flags : 8 = OF_None;
 };
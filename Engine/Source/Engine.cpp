@@ -59,10 +59,17 @@ int main(int argc, char* argv[])
     GarbageCollector& GC = CreateGC();
     GC.SetAutoInterval(0);
     
-    QWorld* World = CreateWorld();
-    GC.AddRoot(World);
+    {
+        // The world lives for the whole session: keep it out of every collection.
+        // World is a root, so its references are still scanned.
+        FGCPermanentRegionScope PermanentScope;
+        
+        QWorld* World = CreateWorld();
+        GC.AddRoot(World);
+    }
 
-    // BeginPlay() all modules.
+    // BeginPlay() all modules. Objects created here stay collectable; a module freezes its own singletons with
+    // GC.MakePermanent() if it needs to.
     M.BeginPlayAll();
 
     // Start background console input
@@ -0,0 +1,344 @@
+﻿#include "Name.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    // Entries live in fixed-size chunks that are allocated on first use and never move, so a published index stays
+    // valid without locking. The hash table is open addressing over atomic slots holding (index + 1), 0 = empty. It
+    // doubles whenever it would pass half full, so probes stay short up to the full entry capacity.
+    constexpr uint32_t ChunkShift = 14;
+    constexpr uint32_t ChunkSize = 1u << ChunkShift;
+    constexpr uint32_t MaxChunks = 1024;
+    constexpr uint32_t InitialNumSlots = 1u << 12;
+    constexpr uint32_t InvalidIndex = ~0u;
+
+    constexpr size_t ArenaBlockSize = 64 * 1024;
+
+    struct FNameEntry
+    {
+        const char* Str = nullptr;
+        uint32_t Len = 0;
+        uint32_t Hash = 0;
+    };
+
+    struct FSlotTable
+    {
+        explicit FSlotTable(const uint32_t NumSlots)
+            : Slots(new std::atomic<uint32_t>[NumSlots]())
+            , Mask(NumSlots - 1)
+        {
+        }
+
+        std::unique_ptr<std::atomic<uint32_t>[]> Slots;
+        uint32_t Mask = 0;
+    };
+
+    struct FArenaBlock
+    {
+        explicit FArenaBlock(FArenaBlock* InNext) : Next(InNext) {}
+
+        char Data[ArenaBlockSize];
+        std::atomic<size_t> Used { 0 };
+        FArenaBlock* Next = nullptr;
+    };
+
+    char ToLower(const char C)
+    {
+        return (C >= 'A' && C <= 'Z') ? static_cast<char>(C + ('a' - 'A')) : C;
+    }
+
+    // FNV-1a over the lower-cased bytes.
+    uint32_t HashNoCase(std::string_view Str)
+    {
+        uint32_t Hash = 2166136261u;
+        for (const char C : Str)
+        {
+            Hash ^= static_cast<unsigned char>(ToLower(C));
+            Hash *= 16777619u;
+        }
+        return Hash;
+    }
+
+    bool EqualsNoCase(const FNameEntry& Entry, std::string_view Str)
+    {
+        if (Entry.Len != Str.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < Str.size(); ++i)
+        {
+            if (ToLower(Entry.Str[i]) != ToLower(Str[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Splits a trailing "_<digits>" off Str. Leading zeros (other than "_0") and numbers of more than MaxNumberDigits
+    // digits stay part of the name so that ToString() reproduces the input exactly.
+    constexpr size_t MaxNumberDigits = 18;  // suffix + 1 always fits in uint64_t
+
+    std::string_view SplitNumber(std::string_view Str, uint64_t& OutNumber)
+    {
+        OutNumber = 0;
+        const size_t Under = Str.rfind('_');
+        if (Under == std::string_view::npos || Under == 0 || Under + 1 == Str.size())
+        {
+            return Str;
+        }
+
+        const std::string_view Digits = Str.substr(Under + 1);
+        if (Digits.size() > MaxNumberDigits || (Digits.size() > 1 && Digits[0] == '0'))
+        {
+            return Str;
+        }
+
+        uint64_t Value = 0;
+        for (const char C : Digits)
+        {
+            if (C < '0' || C > '9')
+            {
+                return Str;
+            }
+            Value = Value * 10 + static_cast<uint64_t>(C - '0');
+        }
+
+        OutNumber = Value + 1;
+        return Str.substr(0, Under);
+    }
+
+    // Lookups are lock-free. Adding a name takes AddMutex: the insert re-probes, grows the slot table when needed and
+    // publishes the slot last. Replaced slot tables are kept alive, since a lookup may still be probing one; a lookup
+    // that races an insert on an old table just misses the new name, and FindOrAdd then retries under the lock.
+    class FNameTable
+    {
+    public:
+        FNameTable()
+        {
+            Tables.push_back(std::make_unique<FSlotTable>(InitialNumSlots));
+            Table.store(Tables.back().get(), std::memory_order_release);
+            
+            // Index 0 is None, so a default FName and FName("None") compare equal.
+            FindOrAdd("None", true);
+        }
+
+        static FNameTable& Get()
+        {
+            static FNameTable Table;
+            return Table;
+        }
+
+        const FNameEntry& GetEntry(const uint32_t Index) const
+        {
+            return Chunks[Index >> ChunkShift].load(std::memory_order_acquire)[Index & (ChunkSize - 1)];
+        }
+
+        uint32_t GetNumEntries() const
+        {
+            return NextIndex.load(std::memory_order_relaxed);
+        }
+
+        uint32_t FindOrAdd(std::string_view Str, const bool bAdd)
+        {
+            const uint32_t Hash = HashNoCase(Str);
+            uint32_t Slot = 0;
+            uint32_t Found = Probe(*Table.load(std::memory_order_acquire), Str, Hash, Slot);
+            if (Found != InvalidIndex || !bAdd)
+            {
+                return Found;
+            }
+
+            std::lock_guard<std::mutex> Lock(AddMutex);
+            FSlotTable* Current = Table.load(std::memory_order_relaxed);
+            Found = Probe(*Current, Str, Hash, Slot);
+            if (Found != InvalidIndex)
+            {
+                return Found;
+            }
+
+            // Keep the load at or below one half, which also guarantees every probe meets an empty slot.
+            const uint64_t NumSlots = uint64_t(Current->Mask) + 1;
+            if ((uint64_t(NextIndex.load(std::memory_order_relaxed)) + 1) * 2 > NumSlots)
+            {
+                Current = Grow(*Current);
+                Probe(*Current, Str, Hash, Slot);
+            }
+
+            // The entry is complete before the slot is published, so a reader that sees the slot sees the entry.
+            const uint32_t Index = NewEntry(Str, Hash);
+            Current->Slots[Slot].store(Index + 1, std::memory_order_release);
+            return Index;
+        }
+
+    private:
+        // Index of Str in T, or InvalidIndex with OutSlot set to the empty slot that ended the probe.
+        uint32_t Probe(const FSlotTable& T, std::string_view Str, const uint32_t Hash, uint32_t& OutSlot) const
+        {
+            for (uint32_t Slot = Hash & T.Mask;; Slot = (Slot + 1) & T.Mask)
+            {
+                const uint32_t Value = T.Slots[Slot].load(std::memory_order_acquire);
+                if (Value == 0)
+                {
+                    OutSlot = Slot;
+                    return InvalidIndex;
+                }
+
+                const FNameEntry& Entry = GetEntry(Value - 1);
+                if (Entry.Hash == Hash && EqualsNoCase(Entry, Str))
+                {
+                    return Value - 1;
+                }
+            }
+        }
+
+        // Rehashes every entry into a table twice the size and publishes it. Called with AddMutex held.
+        FSlotTable* Grow(const FSlotTable& Old)
+        {
+            auto New = std::make_unique<FSlotTable>((Old.Mask + 1) * 2);
+            const uint32_t NumEntries = NextIndex.load(std::memory_order_relaxed);
+            for (uint32_t Index = 0; Index < NumEntries; ++Index)
+            {
+                uint32_t Slot = GetEntry(Index).Hash & New->Mask;
+                while (New->Slots[Slot].load(std::memory_order_relaxed) != 0)
+                {
+                    Slot = (Slot + 1) & New->Mask;
+                }
+                New->Slots[Slot].store(Index + 1, std::memory_order_relaxed);
+            }
+
+            FSlotTable* Published = New.get();
+            Tables.push_back(std::move(New));
+            Table.store(Published, std::memory_order_release);
+            return Published;
+        }
+
+        // Called with AddMutex held.
+        uint32_t NewEntry(std::string_view Str, const uint32_t Hash)
+        {
+            const uint32_t Index = NextIndex.load(std::memory_order_relaxed);
+            const uint32_t ChunkIndex = Index >> ChunkShift;
+            if (ChunkIndex >= MaxChunks)
+            {
+                throw std::length_error("FName: too many names");
+            }
+
+            FNameEntry* Chunk = Chunks[ChunkIndex].load(std::memory_order_relaxed);
+            if (!Chunk)
+            {
+                Chunk = new FNameEntry[ChunkSize];
+                Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+            }
+
+            FNameEntry& Entry = Chunk[Index & (ChunkSize - 1)];
+            Entry.Str = CopyString(Str);
+            Entry.Len = static_cast<uint32_t>(Str.size());
+            Entry.Hash = Hash;
+            NextIndex.store(Index + 1, std::memory_order_relaxed);
+            return Index;
+        }
+
+        // Bump allocation out of 64KB blocks. A thread that overflows the current block pushes a new one; the loser
+        // of that race frees its block and retries.
+        const char* CopyString(std::string_view Str)
+        {
+            if (Str.size() > ArenaBlockSize / 4)
+            {
+                char* Mem = new char[Str.size()];
+                std::memcpy(Mem, Str.data(), Str.size());
+                return Mem;
+            }
+
+            for (;;)
+            {
+                FArenaBlock* Block = Arena.load(std::memory_order_acquire);
+                if (Block)
+                {
+                    const size_t Offset = Block->Used.fetch_add(Str.size(), std::memory_order_relaxed);
+                    if (Offset + Str.size() <= ArenaBlockSize)
+                    {
+                        std::memcpy(Block->Data + Offset, Str.data(), Str.size());
+                        return Block->Data + Offset;
+                    }
+                }
+
+                FArenaBlock* NewBlock = new FArenaBlock(Block);
+                if (!Arena.compare_exchange_strong(Block, NewBlock, std::memory_order_acq_rel))
+                {
+                    delete NewBlock;
+                }
+            }
+        }
+
+        std::atomic<FSlotTable*> Table { nullptr };
+        std::vector<std::unique_ptr<FSlotTable>> Tables;   // every table ever published, the current one last
+        std::mutex AddMutex;
+        std::atomic<FNameEntry*> Chunks[MaxChunks] {};
+        std::atomic<uint32_t> NextIndex { 0 };
+        std::atomic<FArenaBlock*> Arena { nullptr };
+    };
+}
+
+FName::FName(std::string_view Str)
+{
+    if (Str.empty())
+    {
+        return;
+    }
+
+    const std::string_view Base = SplitNumber(Str, Number);
+    Index = FNameTable::Get().FindOrAdd(Base, true);
+}
+
+FName FName::Find(std::string_view Str)
+{
+    FName Result;
+    if (Str.empty())
+    {
+        return Result;
+    }
+
+    uint64_t FoundNumber = 0;
+    const std::string_view Base = SplitNumber(Str, FoundNumber);
+    const uint32_t FoundIndex = FNameTable::Get().FindOrAdd(Base, false);
+    if (FoundIndex != InvalidIndex)
+    {
+        Result.Index = FoundIndex;
+        Result.Number = FoundNumber;
+    }
+    return Result;
+}
+
+std::string_view FName::GetPlainString() const
+{
+    const FNameEntry& Entry = FNameTable::Get().GetEntry(Index);
+    return std::string_view(Entry.Str, Entry.Len);
+}
+
+std::string FName::ToString() const
+{
+    std::string Out;
+    AppendString(Out);
+    return Out;
+}
+
+void FName::AppendString(std::string& Out) const
+{
+    Out.append(GetPlainString());
+    if (Number != 0)
+    {
+        Out.push_back('_');
+        Out.append(std::to_string(Number - 1));
+    }
+}
+
+uint32_t FName::GetNumEntries()
+{
+    return FNameTable::Get().GetNumEntries();
+}
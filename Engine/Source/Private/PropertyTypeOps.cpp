@@ -0,0 +1,334 @@
+﻿#include "PropertyTypeOps.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+#include "GarbageCollector.h"
+
+namespace {
+
+using namespace qmeta;
+
+// No engine header defines FVector yet; properties of that type are three packed floats.
+struct FVectorStorage { float X, Y, Z; };
+
+constexpr size_t MaxPreview = 8;
+
+template<class T>
+void WritePod(std::ostream& Os, const T& V)
+{
+    Os.write(reinterpret_cast<const char*>(&V), sizeof(T));
+}
+
+template<class T>
+T ReadPod(std::istream& Is)
+{
+    T V{};
+    Is.read(reinterpret_cast<char*>(&V), sizeof(T));
+    return V;
+}
+
+void WriteString(std::ostream& Os, const std::string& S)
+{
+    WritePod(Os, static_cast<uint32_t>(S.size()));
+    if (!S.empty()) Os.write(S.data(), static_cast<std::streamsize>(S.size()));
+}
+
+std::string ReadString(std::istream& Is)
+{
+    const uint32_t N = ReadPod<uint32_t>(Is);
+    std::string S(N, '\0');
+    if (N) Is.read(S.data(), N);
+    return S;
+}
+
+void WriteObjectRef(std::ostream& Os, const QObject* Obj)
+{
+    const TypeInfo* Ti = Obj ? GetRegistry().find_by_index(Obj->GetTypeIndex()) : nullptr;
+    WriteString(Os, Ti ? Ti->name : std::string());
+    WriteString(Os, Ti ? Obj->GetDebugName() : std::string());
+}
+
+ObjectRefKey ReadObjectRef(std::istream& Is)
+{
+    ObjectRefKey Key;
+    Key.TypeName = ReadString(Is);
+    Key.Name = ReadString(Is);
+    return Key;
+}
+
+std::string FormatObject(const QObject* Obj)
+{
+    if (!Obj) return "null";
+    if (GarbageCollector::Get().IsManaged(Obj))
+    {
+        std::string Nm = Obj->GetDebugName();
+        return Nm.empty() ? "(Unnamed)" : Nm;
+    }
+    std::ostringstream Os;
+    Os << static_cast<const void*>(Obj);
+    return Os.str();
+}
+
+template<class T>
+void FormatValue(std::ostream& Os, const T& V)
+{
+    if constexpr (std::is_same_v<T, bool>)             Os << (V ? "true" : "false");
+    else if constexpr (std::is_same_v<T, std::string>) Os << '"' << V << '"';
+    else                                               Os << V;
+}
+
+template<class T>
+bool ParseValue(std::string_view Text, T& Out)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        if (Text == "true" || Text == "1")  { Out = true;  return true; }
+        if (Text == "false" || Text == "0") { Out = false; return true; }
+        return false;
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        Out.assign(Text);
+        return true;
+    }
+    else
+    {
+        // Parse into a temporary: from_chars stores a value even when trailing characters make the input invalid
+        T Value{};
+        const char* End = Text.data() + Text.size();
+        auto [Ptr, Ec] = std::from_chars(Text.data(), End, Value);
+        if (Ec != std::errc{} || Ptr != End) return false;
+        Out = Value;
+        return true;
+    }
+}
+
+// "size=N [Tag] [a, b, ...]" with at most MaxPreview elements.
+template<class Vec, class Fn>
+std::string FormatPreview(const Vec& V, std::string_view Tag, Fn&& FormatElem)
+{
+    std::ostringstream Os;
+    Os << "size=" << V.size() << " [" << Tag << "] [";
+    const size_t Limit = std::min(V.size(), MaxPreview);
+    for (size_t i = 0; i < Limit; ++i)
+    {
+        if (i) Os << ", ";
+        FormatElem(Os, V[i]);
+    }
+    if (V.size() > Limit) Os << ", ...";
+    Os << "]";
+    return Os.str();
+}
+
+// ---- Scalars: int/uint 32/64, float, double, bool, std::string ----
+template<class T>
+struct ScalarOps
+{
+    static Variant Get(const void* Addr) { return Variant(*static_cast<const T*>(Addr)); }
+
+    static bool Set(void* Addr, const Variant& V)
+    {
+        if (V.GetBaseType() == Variant::EBaseType::String && !std::is_same_v<T, std::string>)
+        {
+            return Parse(Addr, V.GetString());
+        }
+        try
+        {
+            *static_cast<T*>(Addr) = V.as<T>();
+            return true;
+        }
+        catch (const std::runtime_error&)
+        {
+            return false;
+        }
+    }
+
+    static bool Parse(void* Addr, std::string_view Text) { return ParseValue(Text, *static_cast<T*>(Addr)); }
+
+    static std::string Format(const void* Addr, const MetaProperty&)
+    {
+        std::ostringstream Os;
+        FormatValue(Os, *static_cast<const T*>(Addr));
+        return Os.str();
+    }
+
+    static void Write(std::ostream& Os, const void* Addr)
+    {
+        const T& V = *static_cast<const T*>(Addr);
+        if constexpr (std::is_same_v<T, bool>)             WritePod<uint8_t>(Os, V ? 1u : 0u);
+        else if constexpr (std::is_same_v<T, std::string>) WriteString(Os, V);
+        else                                               WritePod<T>(Os, V);
+    }
+
+    static void Read(std::istream& Is, void* Addr, const ObjectRefResolver&)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            const uint8_t B = ReadPod<uint8_t>(Is);
+            if (Addr) *static_cast<bool*>(Addr) = (B != 0);
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+        {
+            std::string S = ReadString(Is);
+            if (Addr) *static_cast<std::string*>(Addr) = std::move(S);
+        }
+        else
+        {
+            const T V = ReadPod<T>(Is);
+            if (Addr) *static_cast<T*>(Addr) = V;
+        }
+    }
+};
+
+template<class T>
+PropertyTypeOps MakeScalarOps(EPropertyType Code, const char* Name)
+{
+    PropertyTypeOps Ops{ Code, Name };
+    Ops.Get = &ScalarOps<T>::Get;
+    Ops.Set = &ScalarOps<T>::Set;
+    Ops.Parse = &ScalarOps<T>::Parse;
+    Ops.Format = &ScalarOps<T>::Format;
+    Ops.Write = &ScalarOps<T>::Write;
+    Ops.Read = &ScalarOps<T>::Read;
+    return Ops;
+}
+
+// ---- std::vector<T> of scalars: preview only, not part of the .qasset format ----
+template<class T, EPropertyType ElemCode>
+PropertyTypeOps MakeArrayOps(EPropertyType Code, const char* Name)
+{
+    PropertyTypeOps Ops{ Code, Name };
+    Ops.Format = [](const void* Addr, const MetaProperty&) -> std::string
+    {
+        const auto& V = *static_cast<const std::vector<T>*>(Addr);
+        return FormatPreview(V, GetPropertyTypeOps(ElemCode).Name, [](std::ostream& Os, const T& E) { FormatValue(Os, E); });
+    };
+    return Ops;
+}
+
+PropertyTypeOps MakeFVectorOps()
+{
+    PropertyTypeOps Ops{ EPropertyType::FVector, "FVector" };
+    Ops.Format = [](const void* Addr, const MetaProperty&) -> std::string
+    {
+        const auto& V = *static_cast<const FVectorStorage*>(Addr);
+        std::ostringstream Os;
+        Os << "(" << V.X << ", " << V.Y << ", " << V.Z << ")";
+        return Os.str();
+    };
+    Ops.Write = [](std::ostream& Os, const void* Addr)
+    {
+        const auto& V = *static_cast<const FVectorStorage*>(Addr);
+        WritePod(Os, V.X); WritePod(Os, V.Y); WritePod(Os, V.Z);
+    };
+    Ops.Read = [](std::istream& Is, void* Addr, const ObjectRefResolver&)
+    {
+        FVectorStorage V;
+        V.X = ReadPod<float>(Is); V.Y = ReadPod<float>(Is); V.Z = ReadPod<float>(Is);
+        if (Addr) *static_cast<FVectorStorage*>(Addr) = V;
+    };
+    return Ops;
+}
+
+// ---- QObject references: stored as type + debug name, resolved on load ----
+PropertyTypeOps MakeObjectRefOps()
+{
+    PropertyTypeOps Ops{ EPropertyType::ObjectRef, "QObject*" };
+    Ops.Get = [](const void* Addr) { return Variant(*static_cast<QObject* const*>(Addr)); };
+    Ops.Format = [](const void* Addr, const MetaProperty&) { return FormatObject(*static_cast<QObject* const*>(Addr)); };
+    Ops.Write = [](std::ostream& Os, const void* Addr) { WriteObjectRef(Os, *static_cast<QObject* const*>(Addr)); };
+    Ops.Read = [](std::istream& Is, void* Addr, const ObjectRefResolver& Resolve)
+    {
+        const ObjectRefKey Key = ReadObjectRef(Is);
+        if (Addr && Resolve) *static_cast<QObject**>(Addr) = Key.Name.empty() ? nullptr : Resolve(Key);
+    };
+    return Ops;
+}
+
+PropertyTypeOps MakeObjectRefArrayOps()
+{
+    PropertyTypeOps Ops{ EPropertyType::ObjectRefArray, "std::vector<QObject*>" };
+    Ops.Format = [](const void* Addr, const MetaProperty& P) -> std::string
+    {
+        const auto& V = *static_cast<const std::vector<QObject*>*>(Addr);
+        const std::string Tag = (P.ref_type ? P.ref_type->name : std::string("QObject")) + "*";
+        return FormatPreview(V, Tag, [](std::ostream& Os, const QObject* E) { Os << FormatObject(E); });
+    };
+    Ops.Write = [](std::ostream& Os, const void* Addr)
+    {
+        const auto& V = *static_cast<const std::vector<QObject*>*>(Addr);
+        WritePod<uint32_t>(Os, static_cast<uint32_t>(V.size()));
+        for (const QObject* E : V) WriteObjectRef(Os, E);
+    };
+    Ops.Read = [](std::istream& Is, void* Addr, const ObjectRefResolver& Resolve)
+    {
+        const uint32_t N = ReadPod<uint32_t>(Is);
+        std::vector<QObject*> Refs;
+        Refs.reserve(N);
+        for (uint32_t i = 0; i < N; ++i)
+        {
+            const ObjectRefKey Key = ReadObjectRef(Is);
+            if (QObject* Obj = (Resolve && !Key.Name.empty()) ? Resolve(Key) : nullptr) Refs.push_back(Obj);
+        }
+        if (Addr && Resolve) *static_cast<std::vector<QObject*>*>(Addr) = std::move(Refs);
+    };
+    return Ops;
+}
+
+// Unknown kinds are saved as a zero-length placeholder so the file stays readable.
+PropertyTypeOps MakeUnknownOps()
+{
+    PropertyTypeOps Ops{ EPropertyType::Unknown, "unknown" };
+    Ops.Write = [](std::ostream& Os, const void*) { WritePod<uint32_t>(Os, 0); };
+    Ops.Read = [](std::istream& Is, void*, const ObjectRefResolver&) { (void)ReadPod<uint32_t>(Is); };
+    return Ops;
+}
+
+using FOpsTable = std::array<PropertyTypeOps, static_cast<size_t>(EPropertyType::Count)>;
+
+FOpsTable BuildOpsTable()
+{
+    FOpsTable Table{};
+    auto Add = [&Table](const PropertyTypeOps& Ops) { Table[static_cast<size_t>(Ops.Code)] = Ops; };
+
+    Add(MakeUnknownOps());
+    Add(MakeScalarOps<int32_t>(EPropertyType::Int32, "int32"));
+    Add(MakeScalarOps<uint32_t>(EPropertyType::UInt32, "uint32"));
+    Add(MakeScalarOps<int64_t>(EPropertyType::Int64, "int64"));
+    Add(MakeScalarOps<uint64_t>(EPropertyType::UInt64, "uint64"));
+    Add(MakeScalarOps<float>(EPropertyType::Float, "float"));
+    Add(MakeScalarOps<double>(EPropertyType::Double, "double"));
+    Add(MakeScalarOps<bool>(EPropertyType::Bool, "bool"));
+    Add(MakeScalarOps<std::string>(EPropertyType::String, "string"));
+    Add(MakeFVectorOps());
+    Add(MakeObjectRefOps());
+    Add(MakeObjectRefArrayOps());
+    Add(MakeArrayOps<int32_t, EPropertyType::Int32>(EPropertyType::Int32Array, "std::vector<int32>"));
+    Add(MakeArrayOps<uint32_t, EPropertyType::UInt32>(EPropertyType::UInt32Array, "std::vector<uint32>"));
+    Add(MakeArrayOps<int64_t, EPropertyType::Int64>(EPropertyType::Int64Array, "std::vector<int64>"));
+    Add(MakeArrayOps<uint64_t, EPropertyType::UInt64>(EPropertyType::UInt64Array, "std::vector<uint64>"));
+    Add(MakeArrayOps<float, EPropertyType::Float>(EPropertyType::FloatArray, "std::vector<float>"));
+    Add(MakeArrayOps<double, EPropertyType::Double>(EPropertyType::DoubleArray, "std::vector<double>"));
+    Add(MakeArrayOps<bool, EPropertyType::Bool>(EPropertyType::BoolArray, "std::vector<bool>"));
+    Add(MakeArrayOps<std::string, EPropertyType::String>(EPropertyType::StringArray, "std::vector<string>"));
+    return Table;
+}
+
+}
+
+namespace qmeta {
+
+const PropertyTypeOps& GetPropertyTypeOps(EPropertyType Code)
+{
+    static const FOpsTable Table = BuildOpsTable();
+    const size_t Index = static_cast<size_t>(Code);
+    return Table[Index < Table.size() ? Index : 0];
+}
+
+}
@@ -7,6 +7,7 @@
 #include "qmeta_runtime.h"
 #include <condition_variable>
 
+#include "FrameArena.h"
 #include "Console/ConsoleIO.h"
 #include "Console/ConsoleManager.h"
 
@@ -128,9 +129,10 @@ void qruntime::RunMainLoop(std::chrono::milliseconds TimeStep, int MaxCatchUpSte
             }
         }
 
-        // Always process one step.
+        // Always process one step. Transient objects live until the end of the step that created them.
         ProcessPendingCommands();
         Tick(StepSec);
+        FFrameArena::Get().EndFrame();
 
         // Catch up if we fell behind, up to MaxCatchUpSteps.
         int Catchups = 0;
@@ -138,6 +140,7 @@ void qruntime::RunMainLoop(std::chrono::milliseconds TimeStep, int MaxCatchUpSte
         {
             ProcessPendingCommands();
             Tick(StepSec);
+            FFrameArena::Get().EndFrame();
             AccumulatedLate -= StepSec;
             ++Catchups;
         }
@@ -3,7 +3,11 @@
 #include <cstdint>
 #include <vector>
 #include <filesystem>
+#include <functional>
 #include "qmeta_runtime.h"
+#include "PropertyTypeOps.h"
+
+class QObject;
 
 // Binary .qasset serializer/deserializer.
 // Only QPROPERTY/QFUNCTION marked members are stored.
@@ -13,7 +17,14 @@ namespace qasset {
 
     // Magic + version for the .qasset format
     static constexpr uint32_t kMagic = 0x51534154; // 'Q''S''A''T' (QAST)
-    static constexpr uint16_t kVersion = 1;
+    // v2: QObject* and std::vector<QObject*> properties are stored as object ids.
+    // v3: references are stored as type name + debug name. v2 ids belong to the session that saved them, so
+    //     references in a v2 file are skipped on load.
+    static constexpr uint16_t kVersion = 3;
+
+    // Maps a stored reference of Property back to a live object (null when none fits). Must reject objects that
+    // are not a Property.ref_type.
+    using ObjectResolver = std::function<QObject*(const qmeta::ObjectRefKey& Key, const qmeta::MetaProperty& Property)>;
 
     // Decide default dir from TypeInfo.meta["Module"] -> "Engine/Contents" or "Game/Contents".
     std::filesystem::path DefaultAssetDirFor(const qmeta::TypeInfo& Ti);
@@ -24,9 +35,10 @@ namespace qasset {
     bool Save(const void* Obj, const qmeta::TypeInfo& Ti, const std::filesystem::path& OutPath, const std::string& FileNameIfDir = "");
 
     // Load object properties (values) from a .qasset file into an existing instance.
-    // Functions section (if present) is read and ignored.
+    // Functions section (if present) is read and ignored. Object references are resolved through Resolve;
+    // without a resolver they are left untouched.
     // Returns true on success.
-    bool Load(void* Obj, const qmeta::TypeInfo& Ti, const std::filesystem::path& InFile);
+    bool Load(void* Obj, const qmeta::TypeInfo& Ti, const std::filesystem::path& InFile, const ObjectResolver& Resolve = {});
 
     // Optional helpers (throwing versions)
     void SaveOrThrow(const void* Obj, const qmeta::TypeInfo& Ti, const std::filesystem::path& OutPath, const std::string& FileNameIfDir = "");
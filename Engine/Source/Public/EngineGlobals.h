@@ -1,45 +1,111 @@
 ﻿#pragma once
 #include <atomic>
 #include <cstdint>
+#include <new>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
 
+#include "FrameArena.h"
 #include "GarbageCollector.h"
 #include "Object.h"
 #include "qmeta_runtime.h"
 #include "TypeName.h"
 
-static inline std::atomic<uint64_t> NextGlobalId {0};
+// One counter for the whole program: ids double as GC id-index slots and generated debug names.
+inline std::atomic<uint64_t> NextGlobalId {0};
 
 template <class T, class... Args>
 T* NewObject(Args&&... args)
 {
     static_assert(std::is_base_of_v<QObject, T>, "T must derive QObject");
-    const qmeta::TypeInfo* Ti = qmeta::GetRegistry().find(qtype::TypeName<T>());
-    if (!Ti)
+    // Cached per T and looked up by compile-time id: no string work per allocation.
+    const qmeta::TypeInfo* const Ti = &qmeta::StaticTypeInfo<T>();
+    
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Over-aligned QObject types are not supported by the object pools");
+    
+    const uint64_t Id = NextGlobalId.fetch_add(1, std::memory_order_relaxed) + 1; // start at 1
+    if (Id > QObjectBase::MaxObjectId)
     {
-        throw std::runtime_error(std::string("TypeInfo not found for ") + std::string(qtype::TypeName<T>()));
+        throw std::overflow_error("NewObject: object ids exhausted");
     }
     
-    T* Obj = new T(std::forward<Args>(args)...);
+    GarbageCollector& GC = GarbageCollector::Get();
     
-    const uint64_t Id = NextGlobalId.fetch_add(1, std::memory_order_relaxed) + 1; // start at 1
-    Obj->SetObjectId(Id);
+    // Storage comes from the per-type pool (recycled from swept objects when available).
+    void* Mem = GC.AllocateObjectMemory(*Ti);
+    T* Obj = nullptr;
+    try
+    {
+        Obj = ::new (Mem) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        GC.FreeObjectMemory(*Ti, Mem);
+        throw;
+    }
     
-    // Auto debug-name: ClassName_ID
-    std::string AutoName;
-    AutoName.reserve(Ti->name.size() + 20);
-    AutoName.append(Ti->name).push_back('_');
-    AutoName.append(std::to_string(Id));
-    Obj->SetDebugName(AutoName);
+    // The debug name (ClassName_ID) is generated from the header on demand.
+    Obj->InitObjectHeader(Id, Ti->type_index);
+    GC.RegisterInternal(Obj, *Ti, Id);
+    return Obj;
+}
 
-    GarbageCollector& GC = GarbageCollector::Get();
-    GC.RegisterInternal(Obj, *Ti, AutoName, Id);
+// Creates an object in the frame arena (see FFrameArena). It is destroyed at the end of the frame or of the enclosing
+// FFrameArenaScope, is invisible to the GC and must not be referenced from managed objects past that point.
+template <class T, class... Args>
+T* NewTransientObject(Args&&... args)
+{
+    static_assert(std::is_base_of_v<QObject, T>, "T must derive QObject");
+    const qmeta::TypeInfo* const Ti = &qmeta::StaticTypeInfo<T>();
+
+    if (!GarbageCollector::Get().IsGameThread())
+    {
+        throw std::logic_error("NewTransientObject: the frame arena is game-thread only");
+    }
+
+    FFrameArena& Arena = FFrameArena::Get();
+    T* Obj = ::new (Arena.Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    
+    // Ids still come from the global counter so transient objects get distinct debug names.
+    Obj->InitObjectHeader(NextGlobalId.fetch_add(1, std::memory_order_relaxed) + 1, Ti->type_index);
+    Obj->SetFlags(OF_Transient);
+    Arena.AddObject(Obj);
     return Obj;
 }
 
+// Checked downcast through the reflected hierarchy: null unless Obj is a T (or a subclass). Two integer compares,
+// no RTTI. T must be a reflected type.
+template <class T>
+T* QCast(QObject* Obj)
+{
+    static_assert(std::is_base_of_v<QObject, T>, "T must derive QObject");
+    if (!Obj) return nullptr;
+    const qmeta::TypeInfo* Ti = qmeta::GetRegistry().find_by_index(Obj->GetTypeIndex());
+    return Ti && Ti->IsA(qmeta::StaticTypeInfo<T>()) ? static_cast<T*>(Obj) : nullptr;
+}
+
+template <class T>
+const T* QCast(const QObject* Obj)
+{
+    return QCast<T>(const_cast<QObject*>(Obj));
+}
+
+namespace qmeta
+{
+    // Typed reflected call on an engine object; the dynamic type comes from the object header.
+    template <class Sig, class... A>
+    InvokeResult<typename TypedFunctionHandle<Sig>::ReturnType> Invoke(QObject* Obj, const TypedFunctionHandle<Sig>& Handle,
+                                                                       A&&... Args)
+    {
+        if (!Obj) return { EInvokeError::NullObject };
+        const TypeInfo* Ti = GetRegistry().find_by_index(Obj->GetTypeIndex());
+        if (!Ti) return { EInvokeError::TypeMismatch };
+        return Invoke(static_cast<void*>(Obj), *Ti, Handle, std::forward<A>(Args)...);
+    }
+}
+
 // ----- Factory helpers for QHT -----
 namespace qht_factories
 {
@@ -0,0 +1,53 @@
+﻿#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+// Interned, case-insensitive name: a 32-bit index into a global string table plus an optional 64-bit number suffix.
+// "QTestObject_42" is stored as the entry "QTestObject" with Number 43 (0 means no suffix), so per-object names
+// share one table entry. Comparing two FNames is an integer compare. The table only grows; the first spelling
+// seen for an entry is the one returned by ToString(). Inserting is lock-free and safe from any thread.
+class FName
+{
+public:
+    FName() = default;
+    explicit FName(std::string_view Str);
+    explicit FName(const char* Str) : FName(std::string_view(Str)) {}
+    explicit FName(const std::string& Str) : FName(std::string_view(Str)) {}
+    FName(FName Base, uint64_t InNumber) : Index(Base.Index), Number(InNumber) {}
+
+    // Looks a name up without adding it to the table. Returns None if it was never interned.
+    static FName Find(std::string_view Str);
+
+    bool IsNone() const { return Index == 0 && Number == 0; }
+    uint32_t GetIndex() const { return Index; }
+    uint64_t GetNumber() const { return Number; }
+
+    // The entry without the number suffix.
+    FName GetPlainName() const { return FName(*this, 0); }
+    std::string_view GetPlainString() const;
+
+    std::string ToString() const;
+    void AppendString(std::string& Out) const;
+
+    bool operator==(const FName& Other) const { return Index == Other.Index && Number == Other.Number; }
+    bool operator!=(const FName& Other) const { return !(*this == Other); }
+
+    // Number of entries in the table (None included).
+    static uint32_t GetNumEntries();
+
+private:
+    uint32_t Index = 0;     // 0 is None
+    uint64_t Number = 0;    // suffix + 1, 0 when there is none (wide enough for any object id)
+};
+
+template <>
+struct std::hash<FName>
+{
+    size_t operator()(const FName& N) const noexcept
+    {
+        return std::hash<uint64_t>()((N.GetNumber() * 0x9E3779B97F4A7C15ull) ^ N.GetIndex());
+    }
+};
@@ -0,0 +1,81 @@
+﻿#pragma once
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "qmeta_runtime.h"
+
+class QObject;
+
+// One table of operations per EPropertyType. Everything that reads, writes, prints or serializes a reflected
+// property by its type dispatches through GetPropertyTypeOps(P.type_code) instead of comparing type strings.
+
+namespace qmeta {
+
+// A stored object reference. Ids restart every session, so a reference is saved as the target's type name and
+// debug name; it resolves again when an object of that type is alive under that name. Empty Name: null reference.
+struct ObjectRefKey
+{
+    std::string TypeName;
+    std::string Name;
+};
+
+// Maps a stored non-null reference back to a live object (null when none fits). The resolver owns the type check
+// and the GC write barrier for the target it returns.
+using ObjectRefResolver = std::function<QObject*(const ObjectRefKey& Key)>;
+
+struct PropertyTypeOps
+{
+    EPropertyType Code = EPropertyType::Unknown;
+    const char* Name = "unknown";
+
+    // Reads the value as a Variant. Null for kinds without a scalar form.
+    Variant (*Get)(const void* Addr) = nullptr;
+
+    // Stores a Variant converted to the property's type; false when it does not convert. Null for object
+    // references, which must be written through the GC so the barrier sees the new edge.
+    bool (*Set)(void* Addr, const Variant& Value) = nullptr;
+
+    // Parses console text into the property; false on malformed input. Same availability as Set.
+    bool (*Parse)(void* Addr, std::string_view Text) = nullptr;
+
+    // Display string for console listings.
+    std::string (*Format)(const void* Addr, const MetaProperty& P) = nullptr;
+
+    // .qasset payload. Read with a null Addr consumes the payload without storing it. Null for kinds the
+    // format does not store; those are saved as Unknown.
+    void (*Write)(std::ostream& Os, const void* Addr) = nullptr;
+    void (*Read)(std::istream& Is, void* Addr, const ObjectRefResolver& Resolve) = nullptr;
+};
+
+// Always returns a valid entry; out-of-range codes map to Unknown.
+const PropertyTypeOps& GetPropertyTypeOps(EPropertyType Code);
+
+inline const PropertyTypeOps& GetPropertyTypeOps(const MetaProperty& P)
+{
+    return GetPropertyTypeOps(P.type_code);
+}
+
+// Calls F(std::type_identity<T>{}) with the C++ type stored by a scalar kind (numbers, bool, std::string) so bulk
+// paths can run a typed loop instead of dispatching per element. Returns false for every other kind.
+template<class Fn>
+bool VisitScalarPropertyType(EPropertyType Code, Fn&& F)
+{
+    switch (Code)
+    {
+    case EPropertyType::Int32:  F(std::type_identity<int32_t>{});     return true;
+    case EPropertyType::UInt32: F(std::type_identity<uint32_t>{});    return true;
+    case EPropertyType::Int64:  F(std::type_identity<int64_t>{});     return true;
+    case EPropertyType::UInt64: F(std::type_identity<uint64_t>{});    return true;
+    case EPropertyType::Float:  F(std::type_identity<float>{});       return true;
+    case EPropertyType::Double: F(std::type_identity<double>{});      return true;
+    case EPropertyType::Bool:   F(std::type_identity<bool>{});        return true;
+    case EPropertyType::String: F(std::type_identity<std::string>{}); return true;
+    default:                    return false;
+    }
+}
+
+}
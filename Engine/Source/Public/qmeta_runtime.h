@@ -1,74 +1,207 @@
 ﻿#pragma once
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <format>
+#include <new>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
 #include <stdexcept>
 
+#include "Name.h"
+#include "TypeName.h"
+
+class QObject;
+
 namespace qmeta {
 
 // -------- Variant --------
-// Simple type-erased value for RPC arguments and return values.
-struct Variant {
-    enum class EBaseType { Empty, Int, UInt, Float, Double, Bool, String, Pointer };
+// Type-erased value for RPC arguments and return values: a 24-byte tagged union. Strings of up to
+// InlineCapacity chars are stored inline and only longer ones go to the heap, so numeric, object and short
+// string arguments never allocate. QObject* is its own kind; Pointer is kept for raw addresses.
+class Variant {
+public:
+    enum class EBaseType : uint8_t { Empty, Int, UInt, Float, Double, Bool, String, Pointer, Object };
 
-    EBaseType BaseType = EBaseType::Empty;
-    union {
-        int64_t     i64;
-        uint64_t    u64;
-        double      f64;
-        void*       ptr;
-    } data{};
-    std::string str;
+    static constexpr std::size_t InlineCapacity = 16;
 
     Variant() = default;
-    Variant(int v)              { BaseType = EBaseType::Int;   data.i64 = v; }
-    Variant(int64_t v)          { BaseType = EBaseType::Int;   data.i64 = v; }
-    Variant(unsigned v)         { BaseType = EBaseType::UInt;  data.u64 = v; }
-    Variant(uint64_t v)         { BaseType = EBaseType::UInt;  data.u64 = v; }
-    Variant(float v)            { BaseType = EBaseType::Double; data.f64 = static_cast<double>(v); }
-    Variant(double v)           { BaseType = EBaseType::Double; data.f64 = v; }
-    Variant(bool v)             { BaseType = EBaseType::Bool;  data.u64 = v ? 1u : 0u; }
-    Variant(const char* s)      { BaseType = EBaseType::String; str = s; }
-    Variant(std::string s)      { BaseType = EBaseType::String; str = std::move(s); }
-    Variant(void* p)            { BaseType = EBaseType::Pointer; data.ptr = p; }
+    template <class T> requires (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    Variant(T v)
+    {
+        if constexpr (std::is_signed_v<T>) { BaseType = EBaseType::Int;  Data.i64 = v; }
+        else                               { BaseType = EBaseType::UInt; Data.u64 = v; }
+    }
+    Variant(float v)              { BaseType = EBaseType::Double; Data.f64 = static_cast<double>(v); }
+    Variant(double v)             { BaseType = EBaseType::Double; Data.f64 = v; }
+    Variant(bool v)               { BaseType = EBaseType::Bool;  Data.u64 = v ? 1u : 0u; }
+    Variant(std::string_view s)   { SetString(s); }
+    Variant(const char* s)        : Variant(std::string_view(s)) {}
+    Variant(const std::string& s) : Variant(std::string_view(s)) {}
+    Variant(void* p)              { BaseType = EBaseType::Pointer; Data.ptr = p; }
+    Variant(QObject* o)           { BaseType = EBaseType::Object; Data.obj = o; }
+    Variant(std::nullptr_t)       { BaseType = EBaseType::Pointer; Data.ptr = nullptr; }
+
+    Variant(const Variant& Other) { CopyFrom(Other); }
+    Variant(Variant&& Other) noexcept { MoveFrom(Other); }
+    Variant& operator=(const Variant& Other)
+    {
+        if (this != &Other)
+        {
+            Reset();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+    Variant& operator=(Variant&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+    ~Variant() { Reset(); }
+
+    EBaseType GetBaseType() const { return BaseType; }
+    bool IsEmpty() const { return BaseType == EBaseType::Empty; }
+
+    // Empty unless the value is a string. Points into this Variant: valid while it is alive and unchanged.
+    std::string_view GetString() const
+    {
+        if (BaseType != EBaseType::String) return {};
+        return InlineSize == HeapTag ? std::string_view(Data.Heap.Chars, Data.Heap.Size)
+                                     : std::string_view(Data.Inline, InlineSize);
+    }
 
     template<class T>
     T as() const {
-        if constexpr (std::is_same_v<T, int> || std::is_same_v<T,int32_t>) {
-            if (BaseType == EBaseType::Int) return static_cast<int>(data.i64);
-            if (BaseType == EBaseType::UInt) return static_cast<int>(data.u64);
-        } else if constexpr (std::is_same_v<T, int64_t>) {
-            if (BaseType == EBaseType::Int) return data.i64;
-            if (BaseType == EBaseType::UInt) return static_cast<int64_t>(data.u64);
-        } else if constexpr (std::is_same_v<T, unsigned> || std::is_same_v<T,uint32_t>) {
-            if (BaseType == EBaseType::UInt) return static_cast<unsigned>(data.u64);
-            if (BaseType == EBaseType::Int)  return static_cast<unsigned>(data.i64);
-        } else if constexpr (std::is_same_v<T, uint64_t>) {
-            if (BaseType == EBaseType::UInt) return data.u64;
-            if (BaseType == EBaseType::Int)  return static_cast<uint64_t>(data.i64);
-        } else if constexpr (std::is_same_v<T, float>) {
-            if (BaseType == EBaseType::Double) return static_cast<float>(data.f64);
-            if (BaseType == EBaseType::Int)    return static_cast<float>(data.i64);
-            if (BaseType == EBaseType::UInt)   return static_cast<float>(data.u64);
-        } else if constexpr (std::is_same_v<T, double>) {
-            if (BaseType == EBaseType::Double) return data.f64;
-            if (BaseType == EBaseType::Int)    return static_cast<double>(data.i64);
-            if (BaseType == EBaseType::UInt)   return static_cast<double>(data.u64);
-        } else if constexpr (std::is_same_v<T, bool>) {
-            if (BaseType == EBaseType::Bool) return data.u64 != 0;
-            if (BaseType == EBaseType::Int)  return data.i64 != 0;
-            if (BaseType == EBaseType::UInt) return data.u64 != 0;
+        if constexpr (std::is_same_v<T, bool>) {
+            if (BaseType == EBaseType::Bool) return Data.u64 != 0;
+            if (BaseType == EBaseType::Int)  return Data.i64 != 0;
+            if (BaseType == EBaseType::UInt) return Data.u64 != 0;
+        } else if constexpr (std::is_integral_v<T>) {
+            if (BaseType == EBaseType::Int)  return static_cast<T>(Data.i64);
+            if (BaseType == EBaseType::UInt) return static_cast<T>(Data.u64);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (BaseType == EBaseType::Double) return static_cast<T>(Data.f64);
+            if (BaseType == EBaseType::Int)    return static_cast<T>(Data.i64);
+            if (BaseType == EBaseType::UInt)   return static_cast<T>(Data.u64);
         } else if constexpr (std::is_same_v<T, std::string>) {
-            if (BaseType == EBaseType::String) return str;
+            if (BaseType == EBaseType::String) return std::string(GetString());
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            if (BaseType == EBaseType::String) return GetString();
         } else if constexpr (std::is_pointer_v<T>) {
-            if (BaseType == EBaseType::Pointer) return static_cast<T>(data.ptr);
+            using Pointee = std::remove_cv_t<std::remove_pointer_t<T>>;
+            if (BaseType == EBaseType::Pointer) return static_cast<T>(Data.ptr);
+            if constexpr (std::is_void_v<Pointee>) {
+                if (BaseType == EBaseType::Object) return Data.obj;
+            } else if constexpr (std::is_base_of_v<QObject, Pointee>) {
+                if (BaseType == EBaseType::Object) return static_cast<T>(Data.obj);
+            }
         }
         throw std::runtime_error("qmeta::Variant: bad cast");
     }
+
+private:
+    static constexpr uint8_t HeapTag = 0xFF;   // InlineSize value for heap strings
+
+    bool IsHeapString() const { return BaseType == EBaseType::String && InlineSize == HeapTag; }
+
+    void SetString(std::string_view s)
+    {
+        BaseType = EBaseType::String;
+        if (s.size() <= InlineCapacity)
+        {
+            if (!s.empty()) std::memcpy(Data.Inline, s.data(), s.size());
+            InlineSize = static_cast<uint8_t>(s.size());
+        }
+        else
+        {
+            Data.Heap.Chars = new char[s.size()];
+            Data.Heap.Size = s.size();
+            std::memcpy(Data.Heap.Chars, s.data(), s.size());
+            InlineSize = HeapTag;
+        }
+    }
+
+    void CopyFrom(const Variant& Other)
+    {
+        if (Other.IsHeapString())
+        {
+            SetString(Other.GetString());
+            return;
+        }
+        std::memcpy(&Data, &Other.Data, sizeof(Data));
+        BaseType = Other.BaseType;
+        InlineSize = Other.InlineSize;
+    }
+
+    void MoveFrom(Variant& Other) noexcept
+    {
+        std::memcpy(&Data, &Other.Data, sizeof(Data));
+        BaseType = Other.BaseType;
+        InlineSize = Other.InlineSize;
+        Other.BaseType = EBaseType::Empty;
+        Other.InlineSize = 0;
+    }
+
+    void Reset()
+    {
+        if (IsHeapString()) delete[] Data.Heap.Chars;
+        BaseType = EBaseType::Empty;
+        InlineSize = 0;
+    }
+
+    union FStorage {
+        int64_t     i64;
+        uint64_t    u64;
+        double      f64;
+        void*       ptr;
+        QObject*    obj;
+        struct { char* Chars; std::size_t Size; } Heap;
+        char        Inline[InlineCapacity];
+    } Data{};
+    EBaseType BaseType = EBaseType::Empty;
+    uint8_t InlineSize = 0;     // inline string length, or HeapTag
+};
+static_assert(sizeof(Variant) <= 24, "qmeta::Variant should stay within 24 bytes");
+
+// Argument list for reflected calls. The first N arguments are stored inline; only a longer list moves to the
+// heap. Converts to the span taken by FunctionHandle::Invoke and GarbageCollector::Call.
+template <std::size_t N = 8>
+class InlineArgs {
+public:
+    template <class... A>
+    Variant& emplace_back(A&&... Args)
+    {
+        if (Spill.empty() && Count < N)
+        {
+            return Inline[Count++] = Variant(std::forward<A>(Args)...);
+        }
+        if (Spill.empty())
+        {
+            Spill.reserve(N * 2);
+            for (Variant& V : Inline) Spill.push_back(std::move(V));
+        }
+        ++Count;
+        return Spill.emplace_back(std::forward<A>(Args)...);
+    }
+
+    std::size_t size() const { return Count; }
+    const Variant* data() const { return Spill.empty() ? Inline : Spill.data(); }
+    operator std::span<const Variant>() const { return { data(), Count }; }
+
+private:
+    Variant Inline[N];
+    std::vector<Variant> Spill;
+    std::size_t Count = 0;
 };
 
 // -------- Metadata maps --------
@@ -86,7 +219,62 @@ inline bool Any(uint8_t f, uint8_t mask)
 {
     return (f & mask) != 0;
 }
+
+// Canonical storage kind of a reflected property, emitted by QHT next to GcFlags. The scalar and object
+// reference codes double as the .qasset type tag, so their values must never change; new kinds go at the end.
+enum class EPropertyType : uint8_t
+{
+    Unknown = 0,
+    Int32, UInt32, Int64, UInt64, Float, Double, Bool, String, FVector,
+    ObjectRef,              // T* where T : QObject
+    ObjectRefArray,         // std::vector<T*> where T : QObject
+    Int32Array, UInt32Array, Int64Array, UInt64Array, FloatArray, DoubleArray, BoolArray, StringArray,
+    Count
+};
+
+// Maps a declared type spelling to its EPropertyType. Used for registrations that predate QHT emitting the code.
+inline EPropertyType PropertyTypeFromName(std::string_view Type, uint8_t GcFlags)
+{
+    if (GcFlags & PF_RawQObjectPtr) return EPropertyType::ObjectRef;
+    if (GcFlags & PF_VectorOfQObjectPtr) return EPropertyType::ObjectRefArray;
+
+    // Drop cv-qualifiers and all whitespace: "const unsigned int" -> "unsignedint"
+    std::string T;
+    T.reserve(Type.size());
+    for (char c : Type) if (c != ' ' && c != '\t') T.push_back(c);
+    if (T.starts_with("const")) T.erase(0, 5);
+
+    bool bArray = false;
+    if (T.starts_with("std::vector<") && T.ends_with(">"))
+    {
+        T = T.substr(12, T.size() - 13);
+        bArray = true;
+    }
+
+    struct FEntry { std::string_view Names[3]; EPropertyType Scalar; EPropertyType Array; };
+    static constexpr FEntry Table[] = {
+        { { "int", "int32_t", "int32" },                        EPropertyType::Int32,   EPropertyType::Int32Array },
+        { { "unsignedint", "uint32_t", "unsigned" },            EPropertyType::UInt32,  EPropertyType::UInt32Array },
+        { { "int64_t", "longlong", "int64" },                   EPropertyType::Int64,   EPropertyType::Int64Array },
+        { { "uint64_t", "unsignedlonglong", "uint64" },         EPropertyType::UInt64,  EPropertyType::UInt64Array },
+        { { "float" },                                          EPropertyType::Float,   EPropertyType::FloatArray },
+        { { "double" },                                         EPropertyType::Double,  EPropertyType::DoubleArray },
+        { { "bool" },                                           EPropertyType::Bool,    EPropertyType::BoolArray },
+        { { "std::string", "string" },                          EPropertyType::String,  EPropertyType::StringArray },
+        { { "FVector" },                                        EPropertyType::FVector, EPropertyType::Unknown },
+    };
+    for (const FEntry& E : Table)
+    {
+        for (std::string_view N : E.Names)
+        {
+            if (!N.empty() && T == N) return bArray ? E.Array : E.Scalar;
+        }
+    }
+    return EPropertyType::Unknown;
+}
     
+struct TypeInfo;
+
 struct MetaProperty {
     std::string name;
     std::string type;
@@ -94,6 +282,19 @@ struct MetaProperty {
     MetaMap     meta;
 
     uint8_t GcFlags = PF_None;
+
+    // Storage kind plus size/alignment of one element (the value itself, or the vector element for *Array
+    // kinds). Emitted by QHT; link_bases derives type_code from the type string when it was left Unknown.
+    EPropertyType type_code = EPropertyType::Unknown;
+    uint32_t elem_size = 0;
+    uint32_t elem_align = 0;
+
+    // interned name (set by Registry::link_bases)
+    FName name_id;
+
+    // Declared pointee type of a QObject reference (T for T* and std::vector<T*>), null otherwise or when T is not
+    // reflected (set by Registry::link_bases).
+    const TypeInfo* ref_type = nullptr;
 };
 
 struct MetaParam {
@@ -110,11 +311,82 @@ struct MetaFunction {
     std::vector<MetaParam> params;
     InvokeFn    invoker = nullptr;
     MetaMap     meta;
+
+    // Unboxed thunk R(*)(void* Self, Params...) emitted by QHT next to invoker, stored type-erased.
+    // typed_signature is typeid(R(Params...)) and is checked once when a TypedFunctionHandle is resolved.
+    void (*typed_invoker)() = nullptr;
+    const std::type_info* typed_signature = nullptr;
+
+    template <class R, class... Params>
+    void SetTypedInvoker(R(*Fn)(void*, Params...))
+    {
+        typed_invoker = reinterpret_cast<void(*)()>(Fn);
+        typed_signature = &typeid(R(Params...));
+    }
+
+    // interned name (set by Registry::link_bases)
+    FName name_id;
 };
 
+// Moves an instance from Src into raw storage at Dst and destroys the source (used by GC compaction).
+using RelocateFn = void(*)(void* Dst, void* Src);
+
+template <class T>
+void RelocateThunk(void* Dst, void* Src)
+{
+    T* From = static_cast<T*>(Src);
+    ::new (Dst) T(std::move(*From));
+    From->~T();
+}
+
+// Null for types that cannot be moved: not move-constructible, abstract, or pinned with
+// "static constexpr bool bGcPinned = true;" (for types whose address is held by unreflected pointers).
+template <class T>
+constexpr RelocateFn GetRelocateFn()
+{
+    if constexpr (requires { T::bGcPinned; })
+    {
+        if constexpr (T::bGcPinned)
+        {
+            return nullptr;
+        }
+    }
+    
+    if constexpr (std::is_abstract_v<T> || !std::is_move_constructible_v<T>)
+    {
+        return nullptr;
+    }
+    else
+    {
+        return &RelocateThunk<T>;
+    }
+}
+
+// Stable 64-bit id of a reflected type: FNV-1a of its name. Computed at compile time for C++ types (TypeIdOf<T>)
+// and at registration for the names QHT emits; Registry::add_type rejects two names with the same id.
+using TypeId = uint64_t;
+
+constexpr TypeId HashTypeName(std::string_view Name)
+{
+    TypeId Hash = 14695981039346656037ull;
+    for (const char C : Name)
+    {
+        Hash ^= static_cast<unsigned char>(C);
+        Hash *= 1099511628211ull;
+    }
+    return Hash;
+}
+
+template <class T>
+inline constexpr TypeId TypeIdOf = HashTypeName(qtype::TypeName<T>());
+
 struct TypeInfo {
     std::string name;
+    FName name_id;                     // interned name (set by Registry::add_type)
+    TypeId type_id = 0;                // HashTypeName(name) (set by Registry::add_type)
+    uint16_t type_index = 0xFFFF;      // position in the registry (stored in every object header)
     std::size_t size = 0;
+    RelocateFn relocate = nullptr; // set by QHT; null means instances are never moved
     std::vector<MetaProperty> properties;
     std::vector<MetaFunction> functions;
     MetaMap meta;
@@ -125,6 +397,11 @@ struct TypeInfo {
     // resolved base after Registry::link_bases()
     const TypeInfo* base = nullptr;
 
+    // Pre/post-order numbers of this type in a walk of the class hierarchy (set by Registry::link_bases, 0 before).
+    // A type's subclasses are exactly the types whose interval nests inside its own.
+    uint32_t hierarchy_pre = 0;
+    uint32_t hierarchy_post = 0;
+
     template <class F>
     void ForEachProperty(const F& Func) const
     {
@@ -163,21 +440,26 @@ struct TypeInfo {
         for (auto& MetaProp : properties) Func(MetaProp);
     }
 
-    // 3) Simple runtime "is-a" check using the resolved base chain
-    bool IsA(std::string_view TypeName) const
+    // 3) Runtime "is-a" check: two integer compares once the hierarchy is numbered, a base-chain walk before.
+    bool IsA(const TypeInfo& Other) const
     {
-        if (name == TypeName) return true;
-        const TypeInfo* Cur = base;
-        while (Cur)
+        if (hierarchy_post != 0 && Other.hierarchy_post != 0)
         {
-            if (Cur->name == TypeName)
+            return Other.hierarchy_pre <= hierarchy_pre && hierarchy_post <= Other.hierarchy_post;
+        }
+        for (const TypeInfo* Cur = this; Cur; Cur = Cur->base)
+        {
+            if (Cur == &Other)
             {
-                return true;   
+                return true;
             }
-            Cur = Cur->base;
         }
         return false;
     }
+
+    // By name: resolves the type through the registry, then IsA(const TypeInfo&).
+    bool IsA(std::string_view TypeName) const;
+    bool IsA(const FName TypeName) const;
     
     template <class F>
     void ForEachFunction(const F& Func) const
@@ -195,19 +477,26 @@ struct TypeInfo {
     
     const MetaProperty* FindProperty(std::string_view n) const
     {
-        if (base)
+        const FName Name = FName::Find(n);
+        return Name.IsNone() ? nullptr : FindProperty(Name);
+    }
+
+    const MetaProperty* FindProperty(const FName n) const
+    {
+        if (bIndexed)
         {
-            if (auto* r = base->FindProperty(n))
-            {
-                return r;
-            }
+            auto It = PropertyIndex.find(n);
+            return It == PropertyIndex.end() ? nullptr : It->second;
         }
-        
-        for (auto& p : properties)
+
+        for (const TypeInfo* Cur = this; Cur; Cur = Cur->base)
         {
-            if (p.name == n)
+            for (auto& p : Cur->properties)
             {
-                return &p;  
+                if (p.name_id == n)
+                {
+                    return &p;
+                }
             }
         }
         
@@ -216,65 +505,239 @@ struct TypeInfo {
     
     const MetaFunction* FindFunction(std::string_view n) const
     {
-        if (base)
+        const FName Name = FName::Find(n);
+        return Name.IsNone() ? nullptr : FindFunction(Name);
+    }
+
+    const MetaFunction* FindFunction(const FName n) const
+    {
+        if (bIndexed)
+        {
+            auto It = FunctionIndex.find(n);
+            return It == FunctionIndex.end() ? nullptr : It->second;
+        }
+
+        for (const TypeInfo* Cur = this; Cur; Cur = Cur->base)
         {
-            if (auto* r = base->FindFunction(n))
+            for (auto& f : Cur->functions)
             {
-                return r;
+                if (f.name_id == n)
+                {
+                    return &f;
+                }
             }
         }
         
-        for (auto& f : functions)
+        return nullptr;
+    }
+
+    // Rebuilds the flattened lookup tables from the resolved base chain. The most derived declaration of a
+    // name wins, so an overriding QFUNCTION hides the base one. Called by Registry::link_bases().
+    void BuildIndex()
+    {
+        std::vector<const TypeInfo*> Chain;
+        for (const TypeInfo* Cur = this; Cur; Cur = Cur->base)
         {
-            if (f.name == n)
+            Chain.push_back(Cur);
+        }
+
+        PropertyIndex.clear();
+        FunctionIndex.clear();
+        
+        // Root first: derived entries overwrite the base ones.
+        for (auto It = Chain.rbegin(); It != Chain.rend(); ++It)
+        {
+            for (auto& p : (*It)->properties)
+            {
+                PropertyIndex[p.name_id] = &p;
+            }
+            for (auto& f : (*It)->functions)
             {
-                return &f;   
-            }    
+                FunctionIndex[f.name_id] = &f;
+            }
         }
         
-        return nullptr;
+        bIndexed = true;
     }
+
+private:
+    // Every property/function visible on this type (own and inherited), keyed by interned name.
+    // Lookups walk the base chain until the index is built.
+    std::unordered_map<FName, const MetaProperty*> PropertyIndex;
+    std::unordered_map<FName, const MetaFunction*> FunctionIndex;
+    bool bIndexed = false;
 };
 
 class Registry
 {
 public:
+    // Exact spelling resolves by id; anything else falls back to the case-insensitive FName index (console input).
     const TypeInfo* find(std::string_view type_name) const
     {
-        auto it = Types.find(std::string(type_name));
+        if (const TypeInfo* Ti = find_by_id(HashTypeName(type_name)); Ti && Ti->name == type_name)
+        {
+            return Ti;
+        }
+        const FName Name = FName::Find(type_name);
+        return Name.IsNone() ? nullptr : find(Name);
+    }
+
+    const TypeInfo* find(const FName type_name) const
+    {
+        auto it = TypesByName.find(type_name);
+        return it == TypesByName.end() ? nullptr : it->second;
+    }
+
+    const TypeInfo* find_by_id(const TypeId type_id) const
+    {
+        auto it = Types.find(type_id);
         return it == Types.end() ? nullptr : &it->second;
     }
 
+    const TypeInfo* find_by_index(const uint16_t type_index) const
+    {
+        return type_index < TypesByIndex.size() ? TypesByIndex[type_index] : nullptr;
+    }
+
     TypeInfo& add_type(std::string name, std::size_t size)
     {
-        auto [it, inserted] = Types.try_emplace(std::move(name));
+        const TypeId Id = HashTypeName(name);
+        auto [it, inserted] = Types.try_emplace(Id);
         TypeInfo& t = it->second;
-        t.name = it->first;
+        if (!inserted && t.name != name)
+        {
+            throw std::logic_error("qmeta: type id collision between " + t.name + " and " + name);
+        }
+        t.name = std::move(name);
+        t.name_id = FName(t.name);
+        t.type_id = Id;
         t.size = size;
+        if (inserted)
+        {
+            if (TypesByIndex.size() >= 0xFFFF) throw std::length_error("qmeta: too many types");
+            t.type_index = static_cast<uint16_t>(TypesByIndex.size());
+            TypesByIndex.push_back(&t);
+        }
+        TypesByName[t.name_id] = &t;
         return t;
     }
 
+    // Resolves base pointers and interns property/function names (QHT fills only the string names).
     void link_bases()
     {
         for (auto& [_, t] : Types)
         {
+            for (auto& p : t.properties)
+            {
+                p.name_id = FName(p.name);
+                if (p.type_code == EPropertyType::Unknown)
+                {
+                    p.type_code = PropertyTypeFromName(p.type, p.GcFlags);
+                }
+            }
+            for (auto& f : t.functions)
+            {
+                f.name_id = FName(f.name);
+            }
+            
             if (!t.base_name.empty())
             {
-                if (auto Iter = Types.find(t.base_name); Iter != Types.end())
+                if (auto Iter = Types.find(HashTypeName(t.base_name)); Iter != Types.end())
                 {
                     t.base = &Iter->second;    
                 }
             }
         }
+
+        // Bases must all be resolved (and names interned) before any chain is flattened.
+        for (auto& [_, t] : Types)
+        {
+            t.BuildIndex();
+            for (auto& p : t.properties)
+            {
+                p.ref_type = nullptr;
+                if (p.GcFlags & (PF_RawQObjectPtr | PF_VectorOfQObjectPtr))
+                {
+                    p.ref_type = find(ReferencedTypeName(p.type));
+                }
+            }
+        }
+
+        NumberHierarchy();
     }
     
-    const std::unordered_map<std::string, TypeInfo>& all() const
+    const std::unordered_map<TypeId, TypeInfo>& all() const
     {
         return Types;
     }
 
 private:
-    std::unordered_map<std::string, TypeInfo> Types;
+    // "T*", "const T*", "std::vector<T*>" -> "T"
+    static std::string_view ReferencedTypeName(std::string_view Type)
+    {
+        if (const auto Lt = Type.find('<'); Lt != std::string_view::npos)
+        {
+            const auto Gt = Type.rfind('>');
+            Type = Type.substr(Lt + 1, Gt == std::string_view::npos || Gt <= Lt ? std::string_view::npos : Gt - Lt - 1);
+        }
+        auto Trim = [&Type]
+        {
+            while (!Type.empty() && (Type.front() == ' ')) Type.remove_prefix(1);
+            while (!Type.empty() && (Type.back() == ' ' || Type.back() == '*')) Type.remove_suffix(1);
+        };
+        Trim();
+        if (Type.starts_with("const ")) Type.remove_prefix(6);
+        if (const auto Scope = Type.rfind("::"); Scope != std::string_view::npos) Type.remove_prefix(Scope + 2);
+        Trim();
+        return Type;
+    }
+
+    // Depth-first pre/post-order numbering of every inheritance tree, so IsA is an interval-containment test.
+    void NumberHierarchy()
+    {
+        std::vector<std::vector<TypeInfo*>> Children(TypesByIndex.size());
+        std::vector<TypeInfo*> Roots;
+        for (auto& [_, t] : Types)
+        {
+            if (t.base)
+            {
+                Children[t.base->type_index].push_back(&t);
+            }
+            else
+            {
+                Roots.push_back(&t);
+            }
+        }
+
+        uint32_t Counter = 0;
+        struct FFrame { TypeInfo* Type; size_t NextChild; };
+        std::vector<FFrame> Stack;
+        for (TypeInfo* Root : Roots)
+        {
+            Root->hierarchy_pre = ++Counter;
+            Stack.push_back({ Root, 0 });
+            while (!Stack.empty())
+            {
+                FFrame& Top = Stack.back();
+                const std::vector<TypeInfo*>& Kids = Children[Top.Type->type_index];
+                if (Top.NextChild < Kids.size())
+                {
+                    TypeInfo* Child = Kids[Top.NextChild++];
+                    Child->hierarchy_pre = ++Counter;
+                    Stack.push_back({ Child, 0 });
+                }
+                else
+                {
+                    Top.Type->hierarchy_post = ++Counter;
+                    Stack.pop_back();
+                }
+            }
+        }
+    }
+
+    std::unordered_map<TypeId, TypeInfo> Types;
+    std::unordered_map<FName, const TypeInfo*> TypesByName; // case-insensitive, like all FName lookups
+    std::vector<const TypeInfo*> TypesByIndex;
 };
 
 inline Registry& GetRegistry()
@@ -283,61 +746,164 @@ inline Registry& GetRegistry()
     return g;
 }
 
-// Utility: get property address by name
-inline void* GetPropertyPtr(void* Obj, const TypeInfo& Ti, std::string_view PropName)
+inline bool TypeInfo::IsA(std::string_view TypeName) const
 {
-    const TypeInfo* ParentInfo = Ti.base;
-    
-    if (ParentInfo)
+    const TypeInfo* Other = GetRegistry().find(TypeName);
+    return Other && IsA(*Other);
+}
+
+inline bool TypeInfo::IsA(const FName TypeName) const
+{
+    const TypeInfo* Other = GetRegistry().find(TypeName);
+    return Other && IsA(*Other);
+}
+
+// TypeInfo of a C++ type, cached per T: one lookup by compile-time id on first use, a static load afterwards.
+// Throws if T was never registered (the next call retries).
+template <class T>
+const TypeInfo& StaticTypeInfo()
+{
+    static const TypeInfo* const Ti = []
     {
-        for (auto& p : ParentInfo->properties)
+        const TypeInfo* Found = GetRegistry().find_by_id(TypeIdOf<T>);
+        if (!Found)
         {
-            if (p.name == PropName)
-            {
-                return static_cast<void*>(static_cast<unsigned char*>(Obj) + p.offset);
-            }
+            throw std::runtime_error(std::string("TypeInfo not found for ") + std::string(qtype::TypeName<T>()));
         }
+        return Found;
+    }();
+    return *Ti;
+}
+
+// A function resolved once by name, reusable for every object whose type reaches the same MetaFunction.
+// Calling through it skips the name lookup; only the type check is left, and that is a pointer compare for
+// the type it was resolved on.
+struct FunctionHandle {
+    const TypeInfo*     Type = nullptr;    // type the name was resolved on
+    const MetaFunction* Func = nullptr;
+
+    // Invalid (not an error) when the type has no such function.
+    static FunctionHandle Resolve(const TypeInfo& Ti, std::string_view Name)
+    {
+        return FunctionHandle{ &Ti, Ti.FindFunction(Name) };
     }
 
-    for (auto& p : Ti.properties)
+    static FunctionHandle Resolve(const TypeInfo& Ti, const FName Name)
     {
-        if (p.name == PropName)
-        {
-            return static_cast<void*>(static_cast<unsigned char*>(Obj) + p.offset);
-        }
+        return FunctionHandle{ &Ti, Ti.FindFunction(Name) };
     }
-    
-    return nullptr;
-}
 
-// Utility: call a function by name
-inline Variant CallByName(void* Obj, const TypeInfo& Ti, const std::string_view func, const std::vector<Variant>& Args)
+    bool IsValid() const { return Func && Func->invoker; }
+
+    // True if calling the name on an instance of Ti reaches this function: Ti is the resolved type, or a
+    // type that inherits it without overriding. O(1) through the flattened index.
+    bool Matches(const TypeInfo& Ti) const
+    {
+        return &Ti == Type || (Func && Ti.FindFunction(Func->name_id) == Func);
+    }
+
+    // Unchecked: the caller has verified Matches() for Obj's type.
+    Variant Invoke(void* Obj, std::span<const Variant> Args) const
+    {
+        return Func->invoker(Obj, Args.data(), Args.size());
+    }
+};
+
+enum class EInvokeError : uint8_t
 {
-    const TypeInfo* ParentInfo = Ti.base;
-    if (ParentInfo)
+    None,
+    NullObject,
+    Unresolved,     // no such function, or its declared signature differs from the handle's
+    TypeMismatch,   // the object's type does not reach the resolved function
+};
+
+template <class R>
+struct InvokeResult {
+    EInvokeError Error = EInvokeError::None;
+    R Value{};
+    bool Ok() const { return Error == EInvokeError::None; }
+};
+
+template <>
+struct InvokeResult<void> {
+    EInvokeError Error = EInvokeError::None;
+    bool Ok() const { return Error == EInvokeError::None; }
+};
+
+// A FunctionHandle whose declared signature was checked against R(Params...) at resolution, so calls go straight
+// to the QHT typed thunk. Parameter types must match the declaration exactly (e.g. "const std::string&").
+template <class Sig>
+struct TypedFunctionHandle;
+
+template <class R, class... Params>
+struct TypedFunctionHandle<R(Params...)> {
+    using ReturnType = R;
+    using FnType = R(*)(void*, Params...);
+
+    FunctionHandle Handle;
+    FnType Fn = nullptr;
+
+    static TypedFunctionHandle Resolve(const TypeInfo& Ti, std::string_view Name)
     {
-        for (auto& Func : ParentInfo->functions)
+        TypedFunctionHandle Out;
+        Out.Handle = FunctionHandle::Resolve(Ti, Name);
+        const MetaFunction* Func = Out.Handle.Func;
+        if (Func && Func->typed_invoker && Func->typed_signature && *Func->typed_signature == typeid(R(Params...)))
         {
-            if (Func.name == func)
-            {
-                if (!Func.invoker) throw std::runtime_error("qmeta: null invoker");
-                return Func.invoker(Obj, Args.data(), Args.size());
-            }
+            Out.Fn = reinterpret_cast<FnType>(Func->typed_invoker);
         }
+        return Out;
     }
+
+    bool IsValid() const { return Fn != nullptr; }
+    bool Matches(const TypeInfo& Ti) const { return Handle.Matches(Ti); }
+};
+
+// Calls through a typed handle: no Variant boxing and no exceptions from the call machinery (the callee may still
+// throw). ObjType is the dynamic type of Obj.
+template <class Sig, class... A>
+InvokeResult<typename TypedFunctionHandle<Sig>::ReturnType> Invoke(void* Obj, const TypeInfo& ObjType,
+                                                                   const TypedFunctionHandle<Sig>& Handle, A&&... Args)
+{
+    using R = typename TypedFunctionHandle<Sig>::ReturnType;
+    if (!Obj) return { EInvokeError::NullObject };
+    if (!Handle.IsValid()) return { EInvokeError::Unresolved };
+    if (!Handle.Matches(ObjType)) return { EInvokeError::TypeMismatch };
     
-    for (auto& Func : Ti.functions)
+    if constexpr (std::is_void_v<R>)
     {
-        if (Func.name == func)
-        {
-            if (!Func.invoker) throw std::runtime_error("qmeta: null invoker");
-            return Func.invoker(Obj, Args.data(), Args.size());
-        }
+        Handle.Fn(Obj, std::forward<A>(Args)...);
+        return {};
     }
+    else
+    {
+        return { EInvokeError::None, Handle.Fn(Obj, std::forward<A>(Args)...) };
+    }
+}
+
+// Utility: get property address by name (own or inherited)
+inline void* GetPropertyPtr(void* Obj, const TypeInfo& Ti, std::string_view PropName)
+{
+    const MetaProperty* Prop = Ti.FindProperty(PropName);
+    return Prop ? static_cast<void*>(static_cast<unsigned char*>(Obj) + Prop->offset) : nullptr;
+}
+
+// Utility: call a function by name (own or inherited; the most derived override is called)
+inline Variant CallByName(void* Obj, const TypeInfo& Ti, const std::string_view func, std::span<const Variant> Args)
+{
+    const FunctionHandle Handle = FunctionHandle::Resolve(Ti, func);
+    if (!Handle.Func)
+    {
+        throw std::runtime_error(std::format("{}.{} not found", Ti.name, func));
+    }
+    if (!Handle.IsValid()) throw std::runtime_error("qmeta: null invoker");
     
-    std::string Msg = std::format("{}.{} not found", Ti.name, func);
-    
-    throw std::runtime_error(Msg);
+    return Handle.Invoke(Obj, Args);
+}
+
+inline Variant CallByName(void* Obj, const TypeInfo& Ti, const std::string_view func, const std::vector<Variant>& Args)
+{
+    return CallByName(Obj, Ti, func, std::span<const Variant>(Args));
 }
 
 }
\ No newline at end of file
@@ -1,10 +1,11 @@
-// Auto-generated by QHT. Do not edit.
+﻿// Auto-generated by QHT. Do not edit.
 #pragma once
 #include <cstddef>
 #include <vector>
 #include <string>
 #include <unordered_map>
 #include <stdexcept>
+#include <utility>
 #include "qmeta_runtime.h"
 using namespace qmeta;
 // Unit: Game
@@ -15,6 +16,7 @@ using namespace qmeta;
 #include "Test/GcTester.h"
 #include "Test/TestObject.h"
 #include "Test/TestObject_Parent.h"
+#include "Test/TestResourceObject.h"
 
 static Variant _qmeta_invoke_QMonster_GetHealth(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QMonster*>(Self);
@@ -22,6 +24,10 @@ static Variant _qmeta_invoke_QMonster_GetHealth(void* Self, const Variant* args,
     return Variant(_ret);
 }
 
+static int _qmeta_typed_QMonster_GetHealth(void* Self) {
+    return static_cast<QMonster*>(Self)->GetHealth();
+}
+
 static Variant _qmeta_invoke_QMonster_SetHealth(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QMonster*>(Self);
     if (argc < 1) throw std::runtime_error("QMonster::SetHealth requires 1 args");
@@ -30,12 +36,20 @@ static Variant _qmeta_invoke_QMonster_SetHealth(void* Self, const Variant* args,
     return Variant();
 }
 
+static void _qmeta_typed_QMonster_SetHealth(void* Self, int _p0) {
+    return static_cast<QMonster*>(Self)->SetHealth(std::forward<int>(_p0));
+}
+
 static Variant _qmeta_invoke_QMonster_IsDead(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QMonster*>(Self);
     auto _ret = self->IsDead();
     return Variant(_ret);
 }
 
+static bool _qmeta_typed_QMonster_IsDead(void* Self) {
+    return static_cast<QMonster*>(Self)->IsDead();
+}
+
 static Variant _qmeta_invoke_QMonster_TakeDamage(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QMonster*>(Self);
     if (argc < 1) throw std::runtime_error("QMonster::TakeDamage requires 1 args");
@@ -44,12 +58,20 @@ static Variant _qmeta_invoke_QMonster_TakeDamage(void* Self, const Variant* args
     return Variant();
 }
 
+static void _qmeta_typed_QMonster_TakeDamage(void* Self, int _p0) {
+    return static_cast<QMonster*>(Self)->TakeDamage(std::forward<int>(_p0));
+}
+
 static Variant _qmeta_invoke_QMonster_GetTarget(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QMonster*>(Self);
     auto _ret = self->GetTarget();
     return Variant(_ret);
 }
 
+static QActor* _qmeta_typed_QMonster_GetTarget(void* Self) {
+    return static_cast<QMonster*>(Self)->GetTarget();
+}
+
 static Variant _qmeta_invoke_QMonster_SetTarget(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QMonster*>(Self);
     if (argc < 1) throw std::runtime_error("QMonster::SetTarget requires 1 args");
@@ -58,6 +80,10 @@ static Variant _qmeta_invoke_QMonster_SetTarget(void* Self, const Variant* args,
     return Variant();
 }
 
+static void _qmeta_typed_QMonster_SetTarget(void* Self, QActor* _p0) {
+    return static_cast<QMonster*>(Self)->SetTarget(std::forward<QActor*>(_p0));
+}
+
 static Variant _qmeta_invoke_QPlayer_SetWalkSpeed(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QPlayer*>(Self);
     if (argc < 1) throw std::runtime_error("QPlayer::SetWalkSpeed requires 1 args");
@@ -66,6 +92,10 @@ static Variant _qmeta_invoke_QPlayer_SetWalkSpeed(void* Self, const Variant* arg
     return Variant();
 }
 
+static void _qmeta_typed_QPlayer_SetWalkSpeed(void* Self, float _p0) {
+    return static_cast<QPlayer*>(Self)->SetWalkSpeed(std::forward<float>(_p0));
+}
+
 static Variant _qmeta_invoke_QGcTester_PatternChain(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 2) throw std::runtime_error("QGcTester::PatternChain requires 2 args");
@@ -75,6 +105,10 @@ static Variant _qmeta_invoke_QGcTester_PatternChain(void* Self, const Variant* a
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_PatternChain(void* Self, int _p0, int _p1) {
+    return static_cast<QGcTester*>(Self)->PatternChain(std::forward<int>(_p0), std::forward<int>(_p1));
+}
+
 static Variant _qmeta_invoke_QGcTester_PatternGrid(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 3) throw std::runtime_error("QGcTester::PatternGrid requires 3 args");
@@ -85,6 +119,10 @@ static Variant _qmeta_invoke_QGcTester_PatternGrid(void* Self, const Variant* ar
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_PatternGrid(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTester*>(Self)->PatternGrid(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QGcTester_PatternRandom(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 3) throw std::runtime_error("QGcTester::PatternRandom requires 3 args");
@@ -95,6 +133,10 @@ static Variant _qmeta_invoke_QGcTester_PatternRandom(void* Self, const Variant*
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_PatternRandom(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTester*>(Self)->PatternRandom(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QGcTester_PatternRings(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 3) throw std::runtime_error("QGcTester::PatternRings requires 3 args");
@@ -105,6 +147,10 @@ static Variant _qmeta_invoke_QGcTester_PatternRings(void* Self, const Variant* a
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_PatternRings(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTester*>(Self)->PatternRings(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QGcTester_BreakRandomEdges(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 2) throw std::runtime_error("QGcTester::BreakRandomEdges requires 2 args");
@@ -114,6 +160,10 @@ static Variant _qmeta_invoke_QGcTester_BreakRandomEdges(void* Self, const Varian
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_BreakRandomEdges(void* Self, int _p0, int _p1) {
+    return static_cast<QGcTester*>(Self)->BreakRandomEdges(std::forward<int>(_p0), std::forward<int>(_p1));
+}
+
 static Variant _qmeta_invoke_QGcTester_BreakAtDepth(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 3) throw std::runtime_error("QGcTester::BreakAtDepth requires 3 args");
@@ -124,6 +174,10 @@ static Variant _qmeta_invoke_QGcTester_BreakAtDepth(void* Self, const Variant* a
     return Variant(_ret);
 }
 
+static int _qmeta_typed_QGcTester_BreakAtDepth(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTester*>(Self)->BreakAtDepth(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QGcTester_BreakPercent(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 4) throw std::runtime_error("QGcTester::BreakPercent requires 4 args");
@@ -135,6 +189,10 @@ static Variant _qmeta_invoke_QGcTester_BreakPercent(void* Self, const Variant* a
     return Variant(_ret);
 }
 
+static int _qmeta_typed_QGcTester_BreakPercent(void* Self, double _p0, int _p1, int _p2, bool _p3) {
+    return static_cast<QGcTester*>(Self)->BreakPercent(std::forward<double>(_p0), std::forward<int>(_p1), std::forward<int>(_p2), std::forward<bool>(_p3));
+}
+
 static Variant _qmeta_invoke_QGcTester_DetachRoots(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 2) throw std::runtime_error("QGcTester::DetachRoots requires 2 args");
@@ -144,6 +202,10 @@ static Variant _qmeta_invoke_QGcTester_DetachRoots(void* Self, const Variant* ar
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_DetachRoots(void* Self, int _p0, double _p1) {
+    return static_cast<QGcTester*>(Self)->DetachRoots(std::forward<int>(_p0), std::forward<double>(_p1));
+}
+
 static Variant _qmeta_invoke_QGcTester_ClearAll(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 1) throw std::runtime_error("QGcTester::ClearAll requires 1 args");
@@ -152,6 +214,10 @@ static Variant _qmeta_invoke_QGcTester_ClearAll(void* Self, const Variant* args,
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_ClearAll(void* Self, bool _p0) {
+    return static_cast<QGcTester*>(Self)->ClearAll(std::forward<bool>(_p0));
+}
+
 static Variant _qmeta_invoke_QGcTester_RepeatRandomAndCollect(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 3) throw std::runtime_error("QGcTester::RepeatRandomAndCollect requires 3 args");
@@ -162,6 +228,10 @@ static Variant _qmeta_invoke_QGcTester_RepeatRandomAndCollect(void* Self, const
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_RepeatRandomAndCollect(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTester*>(Self)->RepeatRandomAndCollect(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QGcTester_SetAssignMode(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 1) throw std::runtime_error("QGcTester::SetAssignMode requires 1 args");
@@ -170,6 +240,10 @@ static Variant _qmeta_invoke_QGcTester_SetAssignMode(void* Self, const Variant*
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_SetAssignMode(void* Self, int _p0) {
+    return static_cast<QGcTester*>(Self)->SetAssignMode(std::forward<int>(_p0));
+}
+
 static Variant _qmeta_invoke_QGcTester_SetUseVector(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 1) throw std::runtime_error("QGcTester::SetUseVector requires 1 args");
@@ -178,12 +252,20 @@ static Variant _qmeta_invoke_QGcTester_SetUseVector(void* Self, const Variant* a
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_SetUseVector(void* Self, bool _p0) {
+    return static_cast<QGcTester*>(Self)->SetUseVector(std::forward<bool>(_p0));
+}
+
 static Variant _qmeta_invoke_QGcTester_FactoryClear(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     self->FactoryClear();
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_FactoryClear(void* Self) {
+    return static_cast<QGcTester*>(Self)->FactoryClear();
+}
+
 static Variant _qmeta_invoke_QGcTester_FactoryAddType(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 1) throw std::runtime_error("QGcTester::FactoryAddType requires 1 args");
@@ -192,6 +274,10 @@ static Variant _qmeta_invoke_QGcTester_FactoryAddType(void* Self, const Variant*
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_FactoryAddType(void* Self, const std::string& _p0) {
+    return static_cast<QGcTester*>(Self)->FactoryAddType(std::forward<const std::string&>(_p0));
+}
+
 static Variant _qmeta_invoke_QGcTester_FactoryUseTypes(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTester*>(Self);
     if (argc < 1) throw std::runtime_error("QGcTester::FactoryUseTypes requires 1 args");
@@ -200,12 +286,20 @@ static Variant _qmeta_invoke_QGcTester_FactoryUseTypes(void* Self, const Variant
     return Variant();
 }
 
+static void _qmeta_typed_QGcTester_FactoryUseTypes(void* Self, const std::vector<std::string>& _p0) {
+    return static_cast<QGcTester*>(Self)->FactoryUseTypes(std::forward<const std::vector<std::string>&>(_p0));
+}
+
 static Variant _qmeta_invoke_QGcTestManager_Run(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
     self->Run();
     return Variant();
 }
 
+static void _qmeta_typed_QGcTestManager_Run(void* Self) {
+    return static_cast<QGcTestManager*>(Self)->Run();
+}
+
 static Variant _qmeta_invoke_QGcTestManager_PatternChain(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
     if (argc < 2) throw std::runtime_error("QGcTestManager::PatternChain requires 2 args");
@@ -215,6 +309,10 @@ static Variant _qmeta_invoke_QGcTestManager_PatternChain(void* Self, const Varia
     return Variant();
 }
 
+static void _qmeta_typed_QGcTestManager_PatternChain(void* Self, int _p0, int _p1) {
+    return static_cast<QGcTestManager*>(Self)->PatternChain(std::forward<int>(_p0), std::forward<int>(_p1));
+}
+
 static Variant _qmeta_invoke_QGcTestManager_PatternGrid(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
     if (argc < 3) throw std::runtime_error("QGcTestManager::PatternGrid requires 3 args");
@@ -225,6 +323,10 @@ static Variant _qmeta_invoke_QGcTestManager_PatternGrid(void* Self, const Varian
     return Variant();
 }
 
+static void _qmeta_typed_QGcTestManager_PatternGrid(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTestManager*>(Self)->PatternGrid(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QGcTestManager_PatternRandom(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
     if (argc < 3) throw std::runtime_error("QGcTestManager::PatternRandom requires 3 args");
@@ -235,6 +337,10 @@ static Variant _qmeta_invoke_QGcTestManager_PatternRandom(void* Self, const Vari
     return Variant();
 }
 
+static void _qmeta_typed_QGcTestManager_PatternRandom(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTestManager*>(Self)->PatternRandom(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QGcTestManager_PatternRings(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
     if (argc < 3) throw std::runtime_error("QGcTestManager::PatternRings requires 3 args");
@@ -245,6 +351,24 @@ static Variant _qmeta_invoke_QGcTestManager_PatternRings(void* Self, const Varia
     return Variant();
 }
 
+static void _qmeta_typed_QGcTestManager_PatternRings(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTestManager*>(Self)->PatternRings(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
+static Variant _qmeta_invoke_QGcTestManager_PatternRandomParallel(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    if (argc < 3) throw std::runtime_error("QGcTestManager::PatternRandomParallel requires 3 args");
+    auto _a0 = args[0].as<int>();
+    auto _a1 = args[1].as<int>();
+    auto _a2 = args[2].as<int>();
+    self->PatternRandomParallel(_a0, _a1, _a2);
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_PatternRandomParallel(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTestManager*>(Self)->PatternRandomParallel(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QGcTestManager_BreakRandomEdges(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
     if (argc < 2) throw std::runtime_error("QGcTestManager::BreakRandomEdges requires 2 args");
@@ -254,6 +378,10 @@ static Variant _qmeta_invoke_QGcTestManager_BreakRandomEdges(void* Self, const V
     return Variant();
 }
 
+static void _qmeta_typed_QGcTestManager_BreakRandomEdges(void* Self, int _p0, int _p1) {
+    return static_cast<QGcTestManager*>(Self)->BreakRandomEdges(std::forward<int>(_p0), std::forward<int>(_p1));
+}
+
 static Variant _qmeta_invoke_QGcTestManager_BreakAtDepth(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
     if (argc < 3) throw std::runtime_error("QGcTestManager::BreakAtDepth requires 3 args");
@@ -264,6 +392,10 @@ static Variant _qmeta_invoke_QGcTestManager_BreakAtDepth(void* Self, const Varia
     return Variant(_ret);
 }
 
+static int _qmeta_typed_QGcTestManager_BreakAtDepth(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTestManager*>(Self)->BreakAtDepth(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QGcTestManager_BreakPercent(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
     if (argc < 4) throw std::runtime_error("QGcTestManager::BreakPercent requires 4 args");
@@ -275,6 +407,10 @@ static Variant _qmeta_invoke_QGcTestManager_BreakPercent(void* Self, const Varia
     return Variant(_ret);
 }
 
+static int _qmeta_typed_QGcTestManager_BreakPercent(void* Self, double _p0, int _p1, int _p2, bool _p3) {
+    return static_cast<QGcTestManager*>(Self)->BreakPercent(std::forward<double>(_p0), std::forward<int>(_p1), std::forward<int>(_p2), std::forward<bool>(_p3));
+}
+
 static Variant _qmeta_invoke_QGcTestManager_ClearAll(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
     if (argc < 1) throw std::runtime_error("QGcTestManager::ClearAll requires 1 args");
@@ -283,6 +419,145 @@ static Variant _qmeta_invoke_QGcTestManager_ClearAll(void* Self, const Variant*
     return Variant();
 }
 
+static void _qmeta_typed_QGcTestManager_ClearAll(void* Self, bool _p0) {
+    return static_cast<QGcTestManager*>(Self)->ClearAll(std::forward<bool>(_p0));
+}
+
+static Variant _qmeta_invoke_QGcTestManager_BenchmarkClusters(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    if (argc < 3) throw std::runtime_error("QGcTestManager::BenchmarkClusters requires 3 args");
+    auto _a0 = args[0].as<int>();
+    auto _a1 = args[1].as<int>();
+    auto _a2 = args[2].as<int>();
+    self->BenchmarkClusters(_a0, _a1, _a2);
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_BenchmarkClusters(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTestManager*>(Self)->BenchmarkClusters(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
+static Variant _qmeta_invoke_QGcTestManager_BenchmarkTeardown(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    if (argc < 2) throw std::runtime_error("QGcTestManager::BenchmarkTeardown requires 2 args");
+    auto _a0 = args[0].as<int>();
+    auto _a1 = args[1].as<int>();
+    self->BenchmarkTeardown(_a0, _a1);
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_BenchmarkTeardown(void* Self, int _p0, int _p1) {
+    return static_cast<QGcTestManager*>(Self)->BenchmarkTeardown(std::forward<int>(_p0), std::forward<int>(_p1));
+}
+
+static Variant _qmeta_invoke_QGcTestManager_BenchmarkRegion(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    if (argc < 3) throw std::runtime_error("QGcTestManager::BenchmarkRegion requires 3 args");
+    auto _a0 = args[0].as<int>();
+    auto _a1 = args[1].as<int>();
+    auto _a2 = args[2].as<int>();
+    self->BenchmarkRegion(_a0, _a1, _a2);
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_BenchmarkRegion(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTestManager*>(Self)->BenchmarkRegion(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
+static Variant _qmeta_invoke_QGcTestManager_BenchmarkForkMark(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    if (argc < 3) throw std::runtime_error("QGcTestManager::BenchmarkForkMark requires 3 args");
+    auto _a0 = args[0].as<int>();
+    auto _a1 = args[1].as<int>();
+    auto _a2 = args[2].as<int>();
+    self->BenchmarkForkMark(_a0, _a1, _a2);
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_BenchmarkForkMark(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTestManager*>(Self)->BenchmarkForkMark(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
+static Variant _qmeta_invoke_QGcTestManager_CheckStackScan(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    if (argc < 1) throw std::runtime_error("QGcTestManager::CheckStackScan requires 1 args");
+    auto _a0 = args[0].as<int>();
+    self->CheckStackScan(_a0);
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_CheckStackScan(void* Self, int _p0) {
+    return static_cast<QGcTestManager*>(Self)->CheckStackScan(std::forward<int>(_p0));
+}
+
+static Variant _qmeta_invoke_QGcTestManager_BenchmarkTransient(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    if (argc < 1) throw std::runtime_error("QGcTestManager::BenchmarkTransient requires 1 args");
+    auto _a0 = args[0].as<int>();
+    self->BenchmarkTransient(_a0);
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_BenchmarkTransient(void* Self, int _p0) {
+    return static_cast<QGcTestManager*>(Self)->BenchmarkTransient(std::forward<int>(_p0));
+}
+
+static Variant _qmeta_invoke_QGcTestManager_BenchmarkCalls(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    if (argc < 1) throw std::runtime_error("QGcTestManager::BenchmarkCalls requires 1 args");
+    auto _a0 = args[0].as<int>();
+    self->BenchmarkCalls(_a0);
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_BenchmarkCalls(void* Self, int _p0) {
+    return static_cast<QGcTestManager*>(Self)->BenchmarkCalls(std::forward<int>(_p0));
+}
+
+static Variant _qmeta_invoke_QGcTestManager_CheckClusterLink(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    self->CheckClusterLink();
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_CheckClusterLink(void* Self) {
+    return static_cast<QGcTestManager*>(Self)->CheckClusterLink();
+}
+
+static Variant _qmeta_invoke_QGcTestManager_CheckMakePermanent(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    self->CheckMakePermanent();
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_CheckMakePermanent(void* Self) {
+    return static_cast<QGcTestManager*>(Self)->CheckMakePermanent();
+}
+
+static Variant _qmeta_invoke_QGcTestManager_CheckNameTable(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    self->CheckNameTable();
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_CheckNameTable(void* Self) {
+    return static_cast<QGcTestManager*>(Self)->CheckNameTable();
+}
+
+static Variant _qmeta_invoke_QGcTestManager_StressMutators(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QGcTestManager*>(Self);
+    if (argc < 3) throw std::runtime_error("QGcTestManager::StressMutators requires 3 args");
+    auto _a0 = args[0].as<int>();
+    auto _a1 = args[1].as<int>();
+    auto _a2 = args[2].as<int>();
+    self->StressMutators(_a0, _a1, _a2);
+    return Variant();
+}
+
+static void _qmeta_typed_QGcTestManager_StressMutators(void* Self, int _p0, int _p1, int _p2) {
+    return static_cast<QGcTestManager*>(Self)->StressMutators(std::forward<int>(_p0), std::forward<int>(_p1), std::forward<int>(_p2));
+}
+
 static Variant _qmeta_invoke_QTestObject_SetInteger(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QTestObject*>(Self);
     if (argc < 1) throw std::runtime_error("QTestObject::SetInteger requires 1 args");
@@ -291,6 +566,10 @@ static Variant _qmeta_invoke_QTestObject_SetInteger(void* Self, const Variant* a
     return Variant();
 }
 
+static void _qmeta_typed_QTestObject_SetInteger(void* Self, int _p0) {
+    return static_cast<QTestObject*>(Self)->SetInteger(std::forward<int>(_p0));
+}
+
 static Variant _qmeta_invoke_QTestObject_RemoveFriend(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QTestObject*>(Self);
     if (argc < 1) throw std::runtime_error("QTestObject::RemoveFriend requires 1 args");
@@ -299,23 +578,45 @@ static Variant _qmeta_invoke_QTestObject_RemoveFriend(void* Self, const Variant*
     return Variant();
 }
 
+static void _qmeta_typed_QTestObject_RemoveFriend(void* Self, int _p0) {
+    return static_cast<QTestObject*>(Self)->RemoveFriend(std::forward<int>(_p0));
+}
+
 static Variant _qmeta_invoke_QTestObject_RemoveChildren(void* Self, const Variant* args, size_t argc) {
     (void)argc; auto* self = static_cast<QTestObject*>(Self);
     self->RemoveChildren();
     return Variant();
 }
 
+static void _qmeta_typed_QTestObject_RemoveChildren(void* Self) {
+    return static_cast<QTestObject*>(Self)->RemoveChildren();
+}
+
+static Variant _qmeta_invoke_QTestResourceObject_Acquire(void* Self, const Variant* args, size_t argc) {
+    (void)argc; auto* self = static_cast<QTestResourceObject*>(Self);
+    if (argc < 1) throw std::runtime_error("QTestResourceObject::Acquire requires 1 args");
+    auto _a0 = args[0].as<int>();
+    self->Acquire(_a0);
+    return Variant();
+}
+
+static void _qmeta_typed_QTestResourceObject_Acquire(void* Self, int _p0) {
+    return static_cast<QTestResourceObject*>(Self)->Acquire(std::forward<int>(_p0));
+}
+
 inline void QHT_Register_Game(Registry& R) {
     TypeInfo& T_QMonster = R.add_type("QMonster", sizeof(QMonster));
     T_QMonster.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Game")) };
+    T_QMonster.relocate = qmeta::GetRelocateFn<QMonster>();
     T_QMonster.base_name = "QActor";
-    T_QMonster.properties.push_back(MetaProperty{"Health", "int", offsetof(QMonster, Health), MetaMap{}, PF_None });
-    T_QMonster.properties.push_back(MetaProperty{"Target", "QActor*", offsetof(QMonster, Target), MetaMap{}, PF_RawQObjectPtr });
+    T_QMonster.properties.push_back(MetaProperty{"Health", "int", offsetof(QMonster, Health), MetaMap{}, PF_None, EPropertyType::Int32, sizeof(int), alignof(int) });
+    T_QMonster.properties.push_back(MetaProperty{"Target", "QActor*", offsetof(QMonster, Target), MetaMap{}, PF_RawQObjectPtr, EPropertyType::ObjectRef, sizeof(QActor*), alignof(QActor*) });
     {
         MetaFunction F;
         F.name = "GetHealth";
         F.return_type = "int";
         F.invoker = &_qmeta_invoke_QMonster_GetHealth;
+        F.SetTypedInvoker(&_qmeta_typed_QMonster_GetHealth);
         F.params = std::vector<MetaParam>{  };
         F.meta = MetaMap{};
         T_QMonster.functions.push_back(std::move(F));
@@ -325,6 +626,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "SetHealth";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QMonster_SetHealth;
+        F.SetTypedInvoker(&_qmeta_typed_QMonster_SetHealth);
         F.params = std::vector<MetaParam>{ MetaParam{"InHealth", "int"} };
         F.meta = MetaMap{};
         T_QMonster.functions.push_back(std::move(F));
@@ -334,6 +636,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "IsDead";
         F.return_type = "bool";
         F.invoker = &_qmeta_invoke_QMonster_IsDead;
+        F.SetTypedInvoker(&_qmeta_typed_QMonster_IsDead);
         F.params = std::vector<MetaParam>{  };
         F.meta = MetaMap{};
         T_QMonster.functions.push_back(std::move(F));
@@ -343,6 +646,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "TakeDamage";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QMonster_TakeDamage;
+        F.SetTypedInvoker(&_qmeta_typed_QMonster_TakeDamage);
         F.params = std::vector<MetaParam>{ MetaParam{"Damage", "int"} };
         F.meta = MetaMap{};
         T_QMonster.functions.push_back(std::move(F));
@@ -352,6 +656,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "GetTarget";
         F.return_type = "QActor*";
         F.invoker = &_qmeta_invoke_QMonster_GetTarget;
+        F.SetTypedInvoker(&_qmeta_typed_QMonster_GetTarget);
         F.params = std::vector<MetaParam>{  };
         F.meta = MetaMap{};
         T_QMonster.functions.push_back(std::move(F));
@@ -361,37 +666,42 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "SetTarget";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QMonster_SetTarget;
+        F.SetTypedInvoker(&_qmeta_typed_QMonster_SetTarget);
         F.params = std::vector<MetaParam>{ MetaParam{"InTarget", "QActor*"} };
         F.meta = MetaMap{};
         T_QMonster.functions.push_back(std::move(F));
     }
     TypeInfo& T_QPlayer = R.add_type("QPlayer", sizeof(QPlayer));
     T_QPlayer.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Game")) };
+    T_QPlayer.relocate = qmeta::GetRelocateFn<QPlayer>();
     T_QPlayer.base_name = "QActor";
-    T_QPlayer.properties.push_back(MetaProperty{"WalkSpeed", "float", offsetof(QPlayer, WalkSpeed), MetaMap{}, PF_None });
-    T_QPlayer.properties.push_back(MetaProperty{"Name", "std::string", offsetof(QPlayer, Name), MetaMap{}, PF_None });
-    T_QPlayer.properties.push_back(MetaProperty{"Friend", "QPlayer*", offsetof(QPlayer, Friend), MetaMap{}, PF_RawQObjectPtr });
-    T_QPlayer.properties.push_back(MetaProperty{"Friends", "std::vector<QPlayer*>", offsetof(QPlayer, Friends), MetaMap{}, PF_VectorOfQObjectPtr });
+    T_QPlayer.properties.push_back(MetaProperty{"WalkSpeed", "float", offsetof(QPlayer, WalkSpeed), MetaMap{}, PF_None, EPropertyType::Float, sizeof(float), alignof(float) });
+    T_QPlayer.properties.push_back(MetaProperty{"Name", "std::string", offsetof(QPlayer, Name), MetaMap{}, PF_None, EPropertyType::String, sizeof(std::string), alignof(std::string) });
+    T_QPlayer.properties.push_back(MetaProperty{"Friend", "QPlayer*", offsetof(QPlayer, Friend), MetaMap{}, PF_RawQObjectPtr, EPropertyType::ObjectRef, sizeof(QPlayer*), alignof(QPlayer*) });
+    T_QPlayer.properties.push_back(MetaProperty{"Friends", "std::vector<QPlayer*>", offsetof(QPlayer, Friends), MetaMap{}, PF_VectorOfQObjectPtr, EPropertyType::ObjectRefArray, sizeof(QPlayer*), alignof(QPlayer*) });
     {
         MetaFunction F;
         F.name = "SetWalkSpeed";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QPlayer_SetWalkSpeed;
+        F.SetTypedInvoker(&_qmeta_typed_QPlayer_SetWalkSpeed);
         F.params = std::vector<MetaParam>{ MetaParam{"Speed", "float"} };
         F.meta = MetaMap{};
         T_QPlayer.functions.push_back(std::move(F));
     }
     TypeInfo& T_QGcTester = R.add_type("QGcTester", sizeof(QGcTester));
     T_QGcTester.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Game")) };
+    T_QGcTester.relocate = qmeta::GetRelocateFn<QGcTester>();
     T_QGcTester.base_name = "QObject";
-    T_QGcTester.properties.push_back(MetaProperty{"Roots", "std::vector<QObject*>", offsetof(QGcTester, Roots), MetaMap{}, PF_VectorOfQObjectPtr });
-    T_QGcTester.properties.push_back(MetaProperty{"AssignMode", "int", offsetof(QGcTester, AssignMode), MetaMap{}, PF_None });
-    T_QGcTester.properties.push_back(MetaProperty{"bUseVector", "bool", offsetof(QGcTester, bUseVector), MetaMap{}, PF_None });
+    T_QGcTester.properties.push_back(MetaProperty{"Roots", "std::vector<QObject*>", offsetof(QGcTester, Roots), MetaMap{}, PF_VectorOfQObjectPtr, EPropertyType::ObjectRefArray, sizeof(QObject*), alignof(QObject*) });
+    T_QGcTester.properties.push_back(MetaProperty{"AssignMode", "int", offsetof(QGcTester, AssignMode), MetaMap{}, PF_None, EPropertyType::Int32, sizeof(int), alignof(int) });
+    T_QGcTester.properties.push_back(MetaProperty{"bUseVector", "bool", offsetof(QGcTester, bUseVector), MetaMap{}, PF_None, EPropertyType::Bool, sizeof(bool), alignof(bool) });
     {
         MetaFunction F;
         F.name = "PatternChain";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_PatternChain;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_PatternChain);
         F.params = std::vector<MetaParam>{ MetaParam{"Length", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -401,6 +711,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "PatternGrid";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_PatternGrid;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_PatternGrid);
         F.params = std::vector<MetaParam>{ MetaParam{"W", "int"}, MetaParam{"H", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -410,6 +721,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "PatternRandom";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_PatternRandom;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_PatternRandom);
         F.params = std::vector<MetaParam>{ MetaParam{"Nodes", "int"}, MetaParam{"AvgOut", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -419,6 +731,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "PatternRings";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_PatternRings;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_PatternRings);
         F.params = std::vector<MetaParam>{ MetaParam{"Rings", "int"}, MetaParam{"RingSize", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -428,6 +741,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "BreakRandomEdges";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_BreakRandomEdges;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_BreakRandomEdges);
         F.params = std::vector<MetaParam>{ MetaParam{"Count", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -437,6 +751,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "BreakAtDepth";
         F.return_type = "int";
         F.invoker = &_qmeta_invoke_QGcTester_BreakAtDepth;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_BreakAtDepth);
         F.params = std::vector<MetaParam>{ MetaParam{"TargetDepth", "int"}, MetaParam{"Count", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -446,6 +761,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "BreakPercent";
         F.return_type = "int";
         F.invoker = &_qmeta_invoke_QGcTester_BreakPercent;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_BreakPercent);
         F.params = std::vector<MetaParam>{ MetaParam{"Percent", "double"}, MetaParam{"Depth", "int"}, MetaParam{"Seed", "int"}, MetaParam{"bOnlyRoots", "bool"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -455,6 +771,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "DetachRoots";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_DetachRoots;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_DetachRoots);
         F.params = std::vector<MetaParam>{ MetaParam{"Count", "int"}, MetaParam{"Percent", "double"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -464,6 +781,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "ClearAll";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_ClearAll;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_ClearAll);
         F.params = std::vector<MetaParam>{ MetaParam{"bSilent", "bool"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -473,6 +791,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "RepeatRandomAndCollect";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_RepeatRandomAndCollect;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_RepeatRandomAndCollect);
         F.params = std::vector<MetaParam>{ MetaParam{"NumSteps", "int"}, MetaParam{"NumNodes", "int"}, MetaParam{"NumBranches", "int"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -482,6 +801,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "SetAssignMode";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_SetAssignMode;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_SetAssignMode);
         F.params = std::vector<MetaParam>{ MetaParam{"InMode", "int"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -491,6 +811,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "SetUseVector";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_SetUseVector;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_SetUseVector);
         F.params = std::vector<MetaParam>{ MetaParam{"bUse", "bool"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -500,6 +821,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "FactoryClear";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_FactoryClear;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_FactoryClear);
         F.params = std::vector<MetaParam>{  };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -509,6 +831,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "FactoryAddType";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_FactoryAddType;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_FactoryAddType);
         F.params = std::vector<MetaParam>{ MetaParam{"TypeName", "const std::string&"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
@@ -518,18 +841,21 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "FactoryUseTypes";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTester_FactoryUseTypes;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTester_FactoryUseTypes);
         F.params = std::vector<MetaParam>{ MetaParam{"TypeNames", "const std::vector<std::string>&"} };
         F.meta = MetaMap{};
         T_QGcTester.functions.push_back(std::move(F));
     }
     TypeInfo& T_QGcTestManager = R.add_type("QGcTestManager", sizeof(QGcTestManager));
     T_QGcTestManager.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Game")) };
+    T_QGcTestManager.relocate = qmeta::GetRelocateFn<QGcTestManager>();
     T_QGcTestManager.base_name = "QObject";
     {
         MetaFunction F;
         F.name = "Run";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTestManager_Run;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_Run);
         F.params = std::vector<MetaParam>{  };
         F.meta = MetaMap{};
         T_QGcTestManager.functions.push_back(std::move(F));
@@ -539,6 +865,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "PatternChain";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTestManager_PatternChain;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_PatternChain);
         F.params = std::vector<MetaParam>{ MetaParam{"Length", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTestManager.functions.push_back(std::move(F));
@@ -548,6 +875,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "PatternGrid";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTestManager_PatternGrid;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_PatternGrid);
         F.params = std::vector<MetaParam>{ MetaParam{"W", "int"}, MetaParam{"H", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTestManager.functions.push_back(std::move(F));
@@ -557,6 +885,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "PatternRandom";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTestManager_PatternRandom;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_PatternRandom);
         F.params = std::vector<MetaParam>{ MetaParam{"Nodes", "int"}, MetaParam{"AvgOut", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTestManager.functions.push_back(std::move(F));
@@ -566,15 +895,27 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "PatternRings";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTestManager_PatternRings;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_PatternRings);
         F.params = std::vector<MetaParam>{ MetaParam{"Rings", "int"}, MetaParam{"RingSize", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTestManager.functions.push_back(std::move(F));
     }
+    {
+        MetaFunction F;
+        F.name = "PatternRandomParallel";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_PatternRandomParallel;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_PatternRandomParallel);
+        F.params = std::vector<MetaParam>{ MetaParam{"Nodes", "int"}, MetaParam{"AvgOut", "int"}, MetaParam{"Seed", "int"} };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
     {
         MetaFunction F;
         F.name = "BreakRandomEdges";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTestManager_BreakRandomEdges;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_BreakRandomEdges);
         F.params = std::vector<MetaParam>{ MetaParam{"Count", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTestManager.functions.push_back(std::move(F));
@@ -584,6 +925,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "BreakAtDepth";
         F.return_type = "int";
         F.invoker = &_qmeta_invoke_QGcTestManager_BreakAtDepth;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_BreakAtDepth);
         F.params = std::vector<MetaParam>{ MetaParam{"TargetDepth", "int"}, MetaParam{"Count", "int"}, MetaParam{"Seed", "int"} };
         F.meta = MetaMap{};
         T_QGcTestManager.functions.push_back(std::move(F));
@@ -593,6 +935,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "BreakPercent";
         F.return_type = "int";
         F.invoker = &_qmeta_invoke_QGcTestManager_BreakPercent;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_BreakPercent);
         F.params = std::vector<MetaParam>{ MetaParam{"Percent", "double"}, MetaParam{"Depth", "int"}, MetaParam{"Seed", "int"}, MetaParam{"bOnlyRoots", "bool"} };
         F.meta = MetaMap{};
         T_QGcTestManager.functions.push_back(std::move(F));
@@ -602,25 +945,138 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "ClearAll";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QGcTestManager_ClearAll;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_ClearAll);
         F.params = std::vector<MetaParam>{ MetaParam{"bSilent", "bool"} };
         F.meta = MetaMap{};
         T_QGcTestManager.functions.push_back(std::move(F));
     }
+    {
+        MetaFunction F;
+        F.name = "BenchmarkClusters";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_BenchmarkClusters;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_BenchmarkClusters);
+        F.params = std::vector<MetaParam>{ MetaParam{"NodesPerTester", "int"}, MetaParam{"AvgOut", "int"}, MetaParam{"Repeats", "int"} };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "BenchmarkTeardown";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_BenchmarkTeardown;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_BenchmarkTeardown);
+        F.params = std::vector<MetaParam>{ MetaParam{"Count", "int"}, MetaParam{"Megabytes", "int"} };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "BenchmarkRegion";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_BenchmarkRegion;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_BenchmarkRegion);
+        F.params = std::vector<MetaParam>{ MetaParam{"NodesPerTester", "int"}, MetaParam{"AvgOut", "int"}, MetaParam{"BreakCount", "int"} };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "BenchmarkForkMark";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_BenchmarkForkMark;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_BenchmarkForkMark);
+        F.params = std::vector<MetaParam>{ MetaParam{"NodesPerTester", "int"}, MetaParam{"AvgOut", "int"}, MetaParam{"BreakCount", "int"} };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "CheckStackScan";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_CheckStackScan;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_CheckStackScan);
+        F.params = std::vector<MetaParam>{ MetaParam{"Count", "int"} };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "BenchmarkTransient";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_BenchmarkTransient;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_BenchmarkTransient);
+        F.params = std::vector<MetaParam>{ MetaParam{"Count", "int"} };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "BenchmarkCalls";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_BenchmarkCalls;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_BenchmarkCalls);
+        F.params = std::vector<MetaParam>{ MetaParam{"Count", "int"} };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "CheckClusterLink";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_CheckClusterLink;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_CheckClusterLink);
+        F.params = std::vector<MetaParam>{  };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "CheckMakePermanent";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_CheckMakePermanent;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_CheckMakePermanent);
+        F.params = std::vector<MetaParam>{  };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "CheckNameTable";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_CheckNameTable;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_CheckNameTable);
+        F.params = std::vector<MetaParam>{  };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
+    {
+        MetaFunction F;
+        F.name = "StressMutators";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QGcTestManager_StressMutators;
+        F.SetTypedInvoker(&_qmeta_typed_QGcTestManager_StressMutators);
+        F.params = std::vector<MetaParam>{ MetaParam{"NumThreads", "int"}, MetaParam{"Iterations", "int"}, MetaParam{"Nodes", "int"} };
+        F.meta = MetaMap{};
+        T_QGcTestManager.functions.push_back(std::move(F));
+    }
     TypeInfo& T_QTestObject = R.add_type("QTestObject", sizeof(QTestObject));
     T_QTestObject.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Game")) };
+    T_QTestObject.relocate = qmeta::GetRelocateFn<QTestObject>();
     T_QTestObject.base_name = "QTestObject_Parent";
-    T_QTestObject.properties.push_back(MetaProperty{"Integer", "int", offsetof(QTestObject, Integer), MetaMap{}, PF_None });
-    T_QTestObject.properties.push_back(MetaProperty{"Friend1", "QTestObject*", offsetof(QTestObject, Friend1), MetaMap{}, PF_RawQObjectPtr });
-    T_QTestObject.properties.push_back(MetaProperty{"Friend2", "QTestObject*", offsetof(QTestObject, Friend2), MetaMap{}, PF_RawQObjectPtr });
-    T_QTestObject.properties.push_back(MetaProperty{"Friend3", "QTestObject*", offsetof(QTestObject, Friend3), MetaMap{}, PF_RawQObjectPtr });
-    T_QTestObject.properties.push_back(MetaProperty{"Friend4", "QTestObject*", offsetof(QTestObject, Friend4), MetaMap{}, PF_RawQObjectPtr });
-    T_QTestObject.properties.push_back(MetaProperty{"Friend5", "QTestObject*", offsetof(QTestObject, Friend5), MetaMap{}, PF_RawQObjectPtr });
-    T_QTestObject.properties.push_back(MetaProperty{"Children", "std::vector<QTestObject*>", offsetof(QTestObject, Children), MetaMap{}, PF_VectorOfQObjectPtr });
+    T_QTestObject.properties.push_back(MetaProperty{"Integer", "int", offsetof(QTestObject, Integer), MetaMap{}, PF_None, EPropertyType::Int32, sizeof(int), alignof(int) });
+    T_QTestObject.properties.push_back(MetaProperty{"Friend1", "QTestObject*", offsetof(QTestObject, Friend1), MetaMap{}, PF_RawQObjectPtr, EPropertyType::ObjectRef, sizeof(QTestObject*), alignof(QTestObject*) });
+    T_QTestObject.properties.push_back(MetaProperty{"Friend2", "QTestObject*", offsetof(QTestObject, Friend2), MetaMap{}, PF_RawQObjectPtr, EPropertyType::ObjectRef, sizeof(QTestObject*), alignof(QTestObject*) });
+    T_QTestObject.properties.push_back(MetaProperty{"Friend3", "QTestObject*", offsetof(QTestObject, Friend3), MetaMap{}, PF_RawQObjectPtr, EPropertyType::ObjectRef, sizeof(QTestObject*), alignof(QTestObject*) });
+    T_QTestObject.properties.push_back(MetaProperty{"Friend4", "QTestObject*", offsetof(QTestObject, Friend4), MetaMap{}, PF_RawQObjectPtr, EPropertyType::ObjectRef, sizeof(QTestObject*), alignof(QTestObject*) });
+    T_QTestObject.properties.push_back(MetaProperty{"Friend5", "QTestObject*", offsetof(QTestObject, Friend5), MetaMap{}, PF_RawQObjectPtr, EPropertyType::ObjectRef, sizeof(QTestObject*), alignof(QTestObject*) });
+    T_QTestObject.properties.push_back(MetaProperty{"Children", "std::vector<QTestObject*>", offsetof(QTestObject, Children), MetaMap{}, PF_VectorOfQObjectPtr, EPropertyType::ObjectRefArray, sizeof(QTestObject*), alignof(QTestObject*) });
     {
         MetaFunction F;
         F.name = "SetInteger";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QTestObject_SetInteger;
+        F.SetTypedInvoker(&_qmeta_typed_QTestObject_SetInteger);
         F.params = std::vector<MetaParam>{ MetaParam{"InValue", "int"} };
         F.meta = MetaMap{};
         T_QTestObject.functions.push_back(std::move(F));
@@ -630,6 +1086,7 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "RemoveFriend";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QTestObject_RemoveFriend;
+        F.SetTypedInvoker(&_qmeta_typed_QTestObject_RemoveFriend);
         F.params = std::vector<MetaParam>{ MetaParam{"Idx", "int"} };
         F.meta = MetaMap{};
         T_QTestObject.functions.push_back(std::move(F));
@@ -639,14 +1096,32 @@ inline void QHT_Register_Game(Registry& R) {
         F.name = "RemoveChildren";
         F.return_type = "void";
         F.invoker = &_qmeta_invoke_QTestObject_RemoveChildren;
+        F.SetTypedInvoker(&_qmeta_typed_QTestObject_RemoveChildren);
         F.params = std::vector<MetaParam>{  };
         F.meta = MetaMap{};
         T_QTestObject.functions.push_back(std::move(F));
     }
     TypeInfo& T_QTestObject_Parent = R.add_type("QTestObject_Parent", sizeof(QTestObject_Parent));
     T_QTestObject_Parent.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Game")) };
+    T_QTestObject_Parent.relocate = qmeta::GetRelocateFn<QTestObject_Parent>();
     T_QTestObject_Parent.base_name = "QObject";
-    T_QTestObject_Parent.properties.push_back(MetaProperty{"Children_Parent", "std::vector<QObject*>", offsetof(QTestObject_Parent, Children_Parent), MetaMap{}, PF_VectorOfQObjectPtr });
+    T_QTestObject_Parent.properties.push_back(MetaProperty{"Children_Parent", "std::vector<QObject*>", offsetof(QTestObject_Parent, Children_Parent), MetaMap{}, PF_VectorOfQObjectPtr, EPropertyType::ObjectRefArray, sizeof(QObject*), alignof(QObject*) });
+    TypeInfo& T_QTestResourceObject = R.add_type("QTestResourceObject", sizeof(QTestResourceObject));
+    T_QTestResourceObject.meta = MetaMap{ std::make_pair(std::string("Module"), std::string("Game")) };
+    T_QTestResourceObject.relocate = qmeta::GetRelocateFn<QTestResourceObject>();
+    T_QTestResourceObject.base_name = "QObject";
+    T_QTestResourceObject.properties.push_back(MetaProperty{"bAsyncTeardown", "bool", offsetof(QTestResourceObject, bAsyncTeardown), MetaMap{}, PF_None, EPropertyType::Bool, sizeof(bool), alignof(bool) });
+    T_QTestResourceObject.properties.push_back(MetaProperty{"NumChunks", "int", offsetof(QTestResourceObject, NumChunks), MetaMap{}, PF_None, EPropertyType::Int32, sizeof(int), alignof(int) });
+    {
+        MetaFunction F;
+        F.name = "Acquire";
+        F.return_type = "void";
+        F.invoker = &_qmeta_invoke_QTestResourceObject_Acquire;
+        F.SetTypedInvoker(&_qmeta_typed_QTestResourceObject_Acquire);
+        F.params = std::vector<MetaParam>{ MetaParam{"Megabytes", "int"} };
+        F.meta = MetaMap{};
+        T_QTestResourceObject.functions.push_back(std::move(F));
+    }
 }
 
 // ===== Auto-generated factories (QHT) =====
@@ -656,6 +1131,7 @@ inline void QHT_Register_Game(Registry& R) {
 #include "Test/GcTestManager.h"
 #include "Test/TestObject.h"
 #include "Test/TestObject_Parent.h"
+#include "Test/TestResourceObject.h"
 #include "EngineGlobals.h"
 #include "GarbageCollector.h"
 namespace qht_factories_gen_Game {
@@ -667,6 +1143,7 @@ namespace qht_factories_gen_Game {
         qht_factories::RegisterIfCreatable<QGcTestManager>("QGcTestManager");
         qht_factories::RegisterIfCreatable<QTestObject>("QTestObject");
         qht_factories::RegisterIfCreatable<QTestObject_Parent>("QTestObject_Parent");
+        qht_factories::RegisterIfCreatable<QTestResourceObject>("QTestResourceObject");
     }
     struct FAutoReg_Game { FAutoReg_Game() { RegisterFactories_Game(); } };
     static FAutoReg_Game GAutoReg_Game;
@@ -1,12 +1,19 @@
 ﻿#include "GcTestManager.h"
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <thread>
+
+#include "GcSafepoint.h"
+#include "Name.h"
 
 #include "TestObject.h"
+#include "TestResourceObject.h"
 
 QGcTestManager::QGcTestManager()
 {
-    bGcIgnoredSelfAndBelow = true;
+    SetGcIgnoredSelfAndBelow(true);
 }
 
 
@@ -69,6 +76,103 @@ void QGcTestManager::PatternRandom(int Nodes, int AvgOut, int Seed)
     }
 }
 
+void QGcTestManager::PatternRandomParallel(int Nodes, int AvgOut, int Seed)
+{
+    const auto T0 = std::chrono::high_resolution_clock::now();
+    
+    std::vector<std::thread> Threads;
+    Threads.reserve(Testers.size());
+    for (QGcTester* Tester : Testers)
+    {
+        Threads.emplace_back([=]() { Tester->PatternRandom(Nodes, AvgOut, Seed); });
+    }
+    for (std::thread& T : Threads)
+    {
+        T.join();
+    }
+
+    // Publish the objects created by the workers to the GC tables.
+    const size_t NumMerged = GarbageCollector::Get().FlushRegistrations();
+    
+    const double Ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - T0).count();
+    std::cout << "[GcTestManager] PatternRandomParallel threads=" << Threads.size() << " merged=" << NumMerged
+              << " in " << Ms << " ms\n";
+}
+
+void QGcTestManager::StressMutators(int NumThreads, int Iterations, int Nodes)
+{
+    NumThreads = std::min(NumThreads, static_cast<int>(Testers.size()));
+    if (NumThreads <= 0 || Iterations <= 0 || Nodes < 0)
+    {
+        std::cout << "[GcTestManager] StressMutators: threads>0 (max " << Testers.size() << "), iterations>0, nodes>=0\n";
+        return;
+    }
+
+    auto& GC = GarbageCollector::Get();
+    ClearGeneratedAll();
+    GC.Collect(true);
+    const size_t BaseAlive = GC.GetLastStats().NumAlive;
+
+    std::atomic<int> Running {NumThreads};
+    std::vector<std::thread> Threads;
+    Threads.reserve(NumThreads);
+    for (int i = 0; i < NumThreads; ++i)
+    {
+        QGcTester* Tester = Testers[i];
+        Threads.emplace_back([=, &Running]()
+        {
+            FGcMutatorScope Mutator("GcWorker_" + std::to_string(i));
+            for (int It = 0; It < Iterations; ++It)
+            {
+                // Between safepoints the previous graph becomes garbage and a new one hangs off the tester.
+                Tester->Roots.clear();
+                QTestObject* Head = NewObject<QTestObject>();
+                for (int n = 0; n < Nodes; ++n)
+                {
+                    Head->Children.push_back(NewObject<QTestObject>());
+                }
+                Tester->Roots.push_back(Head);
+                
+                GcSafepoint();
+            }
+            Running.fetch_sub(1);
+        });
+    }
+
+    int NumCollections = 0;
+    double SumTtsp = 0.0, MaxTtsp = 0.0;
+    while (Running.load() > 0)
+    {
+        GC.Collect(true);
+        ++NumCollections;
+        SumTtsp += GC.GetLastStats().SafepointMs;
+        MaxTtsp = std::max(MaxTtsp, GC.GetLastStats().SafepointMs);
+    }
+
+    for (std::thread& T : Threads)
+    {
+        T.join();
+    }
+
+    // Merge first: objects merged by Collect() itself would survive that collection as roots.
+    GC.FlushRegistrations();
+    GC.Collect(true);
+    const size_t Alive = GC.GetLastStats().NumAlive;
+    const size_t Expected = BaseAlive + size_t(NumThreads) * (Nodes + 1);
+
+    std::cout << "[GcTestManager] StressMutators threads=" << NumThreads << " iterations=" << Iterations
+              << " nodes=" << Nodes << " collections=" << NumCollections << "\n";
+    std::cout << " - time to safepoint: avg=" << (NumCollections ? SumTtsp / NumCollections : 0.0)
+              << " ms, max=" << MaxTtsp << " ms\n";
+    std::cout << " - alive=" << Alive << " expected=" << Expected << "\n";
+    if (Alive != Expected)
+    {
+        std::cout << "[GcTestManager] WARNING: heap does not match the mutators' final graphs\n";
+    }
+
+    ClearGeneratedAll();
+}
+
 void QGcTestManager::PatternRings(int Rings, int RingSize, int Seed)
 {
     for (auto& Tester : Testers)
@@ -115,3 +219,505 @@ void QGcTestManager::ClearAll(bool bSilent)
     }
 }
 
+void QGcTestManager::BenchmarkClusters(int NodesPerTester, int AvgOut, int Repeats)
+{
+    if (NodesPerTester <= 0 || AvgOut < 0 || Repeats <= 0)
+    {
+        std::cout << "[GcTestManager] BenchmarkClusters: nodes>0, avgOut>=0, repeats>0\n";
+        return;
+    }
+
+    auto& GC = GarbageCollector::Get();
+
+    BuildGraphsRandomForAll(NodesPerTester, AvgOut, 42);
+    GC.Collect(true); // drop garbage from previous graphs so both runs see the same heap
+
+    auto Measure = [&](double& OutMarkMs, double& OutTotalMs, size_t& OutAlive)
+    {
+        OutMarkMs = 0.0;
+        OutTotalMs = 0.0;
+        for (int i = 0; i < Repeats; ++i)
+        {
+            GC.Collect(true);
+            OutMarkMs += GC.GetLastStats().MarkMs;
+            OutTotalMs += GC.GetLastStats().TotalMs;
+        }
+        OutMarkMs /= Repeats;
+        OutTotalMs /= Repeats;
+        OutAlive = GC.GetLastStats().NumAlive;
+    };
+
+    double PlainMark = 0.0, PlainTotal = 0.0;
+    size_t PlainAlive = 0;
+    Measure(PlainMark, PlainTotal, PlainAlive);
+
+    size_t Members = 0;
+    for (QGcTester* Tester : Testers)
+    {
+        if (Tester) Members += GC.CreateCluster(Tester);
+    }
+    const size_t NumClusters = GC.GetNumClusters();
+
+    double ClusterMark = 0.0, ClusterTotal = 0.0;
+    size_t ClusterAlive = 0;
+    Measure(ClusterMark, ClusterTotal, ClusterAlive);
+
+    for (QGcTester* Tester : Testers)
+    {
+        if (Tester) GC.DissolveCluster(Tester);
+    }
+
+    std::cout << "[GcTestManager] BenchmarkClusters testers=" << Testers.size()
+              << " nodes/tester=" << NodesPerTester << " avgOut=" << AvgOut << " repeats=" << Repeats << "\n";
+    std::cout << " - unclustered: mark=" << PlainMark << " ms, total=" << PlainTotal << " ms, alive=" << PlainAlive << "\n";
+    std::cout << " - clustered:   mark=" << ClusterMark << " ms, total=" << ClusterTotal << " ms, alive=" << ClusterAlive
+              << " (clusters=" << NumClusters << ", members=" << Members << ")\n";
+    if (ClusterMark > 0.0)
+    {
+        std::cout << " - mark speedup x" << (PlainMark / ClusterMark) << "\n";
+    }
+    if (PlainAlive != ClusterAlive)
+    {
+        std::cout << "[GcTestManager] WARNING: alive count differs between runs\n";
+    }
+}
+
+void QGcTestManager::BenchmarkRegion(int NodesPerTester, int AvgOut, int BreakCount)
+{
+    if (NodesPerTester <= 0 || AvgOut < 0 || BreakCount <= 0 || Testers.empty())
+    {
+        std::cout << "[GcTestManager] BenchmarkRegion: nodes>0, avgOut>=0, breakCount>0, testers>0\n";
+        return;
+    }
+
+    auto& GC = GarbageCollector::Get();
+    ClearGeneratedAll();
+    GC.Collect(true);
+
+    int Idx = 0;
+    for (QGcTester* Tester : Testers)
+    {
+        Tester->ClearGenerated();
+        FGCRootRegionScope Scope(Tester);
+        Tester->PatternRandom(NodesPerTester, AvgOut, 42 + Idx++);
+    }
+    GC.Collect(true); // records cross-region references for the region pass below
+
+    QGcTester* Target = Testers.front();
+    
+    Target->BreakRandomEdges(BreakCount, 7);
+    GC.Collect(true);
+    const GarbageCollector::FGcStats Full = GC.GetLastStats();
+
+    Target->BreakRandomEdges(BreakCount, 8);
+    GC.CollectRegion(Target, true);
+    const GarbageCollector::FGcStats Region = GC.GetLastStats();
+
+    std::cout << "[GcTestManager] BenchmarkRegion testers=" << Testers.size() << " nodes/tester=" << NodesPerTester
+              << " avgOut=" << AvgOut << " breakCount=" << BreakCount << "\n";
+    std::cout << " - full collect:   mark=" << Full.MarkMs << " ms, total=" << Full.TotalMs << " ms, collected="
+              << Full.NumCollected << "\n";
+    std::cout << " - region collect: mark=" << Region.MarkMs << " ms, total=" << Region.TotalMs << " ms, collected="
+              << Region.NumCollected << " (region size=" << GC.GetRegionSize(Target) << ")\n";
+
+    for (QGcTester* Tester : Testers)
+    {
+        GC.RemoveRootRegion(Tester);
+    }
+}
+
+void QGcTestManager::BenchmarkForkMark(int NodesPerTester, int AvgOut, int BreakCount)
+{
+    if (NodesPerTester <= 0 || AvgOut < 0 || BreakCount <= 0)
+    {
+        std::cout << "[GcTestManager] BenchmarkForkMark: nodes>0, avgOut>=0, breakCount>0\n";
+        return;
+    }
+
+    auto& GC = GarbageCollector::Get();
+    const GarbageCollector::EGcMode PrevMode = GC.GetMode();
+    if (!GC.SetMode(GarbageCollector::EGcMode::StopTheWorld))
+    {
+        return;
+    }
+
+    // Both runs start from the same heap and collect the same amount of garbage.
+    auto Prepare = [&]()
+    {
+        BuildGraphsRandomForAll(NodesPerTester, AvgOut, 42);
+        GC.Collect(true);
+        BreakRandomEdges(BreakCount, 7);
+    };
+
+    Prepare();
+    GC.Collect(true);
+    const GarbageCollector::FGcStats Stw = GC.GetLastStats();
+
+    Prepare();
+    if (!GC.SetMode(GarbageCollector::EGcMode::Fork))
+    {
+        std::cout << "[GcTestManager] BenchmarkForkMark: fork mode is only supported on Linux\n";
+        GC.SetMode(PrevMode);
+        return;
+    }
+    GC.Collect(true);
+    GC.FinishForkCollect(true);
+    const GarbageCollector::FGcStats Fork = GC.GetLastStats();
+    GC.SetMode(PrevMode);
+
+    std::cout << "[GcTestManager] BenchmarkForkMark testers=" << Testers.size() << " nodes/tester=" << NodesPerTester
+              << " avgOut=" << AvgOut << " breakCount=" << BreakCount << "\n";
+    std::cout << " - stop-the-world: pause=" << Stw.TotalMs << " ms (mark=" << Stw.MarkMs << " ms), collected="
+              << Stw.NumCollected << "\n";
+    std::cout << " - fork:           pause=" << (Fork.ForkMs + Fork.TotalMs) << " ms (fork=" << Fork.ForkMs
+              << " ms, sweep pause=" << Fork.TotalMs << " ms, child mark=" << Fork.MarkMs << " ms), collected="
+              << Fork.NumCollected << "\n";
+    if (Stw.NumCollected != Fork.NumCollected)
+    {
+        std::cout << "[GcTestManager] WARNING: collected count differs between modes\n";
+    }
+}
+
+void QGcTestManager::CheckStackScan(int Count)
+{
+    constexpr int MaxLocals = 16;
+    if (Count <= 0 || Count > MaxLocals)
+    {
+        std::cout << "[GcTestManager] CheckStackScan: 0<count<=" << MaxLocals << "\n";
+        return;
+    }
+
+    auto& GC = GarbageCollector::Get();
+    const bool bPrevScan = GC.GetConservativeStackScan();
+
+    auto Run = [&](bool bScan, double& OutMs)
+    {
+        if (!GC.SetConservativeStackScan(bScan))
+        {
+            return -1;
+        }
+
+        // Only the local array refers to these objects.
+        QTestObject* Locals[MaxLocals] = {};
+        uint64_t Ids[MaxLocals] = {};
+        for (int i = 0; i < Count; ++i)
+        {
+            Locals[i] = NewObject<QTestObject>();
+            Ids[i] = Locals[i]->GetObjectId();
+        }
+
+        OutMs = GC.Collect(true);
+
+        int Survived = 0;
+        for (int i = 0; i < Count; ++i)
+        {
+            // Ids are never reused, so a lookup by id cannot confuse a swept object with a new one.
+            Survived += GC.FindById(Ids[i]) == Locals[i] ? 1 : 0;
+        }
+        return Survived;
+    };
+
+    double ScanMs = 0.0, PlainMs = 0.0;
+    const int WithScan = Run(true, ScanMs);
+    const int WithoutScan = Run(false, PlainMs);
+    GC.SetConservativeStackScan(bPrevScan);
+
+    if (WithScan < 0)
+    {
+        std::cout << "[GcTestManager] CheckStackScan: conservative stack scan is only supported on Linux\n";
+        return;
+    }
+
+    std::cout << "[GcTestManager] CheckStackScan count=" << Count << "\n";
+    std::cout << " - scan on:  survived=" << WithScan << ", collect=" << ScanMs << " ms\n";
+    std::cout << " - scan off: survived=" << WithoutScan << ", collect=" << PlainMs << " ms\n";
+    if (WithScan != Count)
+    {
+        std::cout << "[GcTestManager] WARNING: objects held in locals were collected with the stack scan on\n";
+    }
+}
+
+void QGcTestManager::CheckClusterLink()
+{
+    auto& GC = GarbageCollector::Get();
+
+    // Locals must not keep the new object alive, or the missing edge would go unnoticed.
+    const bool bPrevScan = GC.GetConservativeStackScan();
+    GC.SetConservativeStackScan(false);
+
+    QTestObject* Root = NewObject<QTestObject>();
+    FGCScopedRoot Pin(Root);
+    QTestObject* Member = NewObject<QTestObject>();
+    GC.Link(Root, "Friend1", Member);
+
+    const size_t NumMembers = GC.CreateCluster(Root);
+
+    // Member is frozen in the cluster; the only path to Fresh is the edge added after formation.
+    QTestObject* Fresh = NewObject<QTestObject>();
+    const uint64_t FreshId = Fresh->GetObjectId();
+    GC.Link(Member, "Friend1", Fresh);
+    const bool bDissolved = !GC.IsInCluster(Root);
+
+    GC.Collect(true);
+
+    const bool bSurvived = GC.FindById(FreshId) == Fresh;
+    const bool bEdgeKept = bSurvived && Member->Friend1 == Fresh;
+
+    Pin.Reset();
+    GC.SetConservativeStackScan(bPrevScan);
+    GC.Collect(true);
+
+    std::cout << "[GcTestManager] CheckClusterLink members=" << NumMembers << ", dissolved=" << (bDissolved ? "yes" : "no")
+              << ", survived=" << (bSurvived ? "yes" : "no") << ", edge=" << (bEdgeKept ? "kept" : "lost") << "\n";
+    if (NumMembers != 2 || !bSurvived || !bEdgeKept)
+    {
+        std::cout << "[GcTestManager] FAILED: an object linked into a clustered member was collected\n";
+    }
+}
+
+void QGcTestManager::CheckMakePermanent()
+{
+    auto& GC = GarbageCollector::Get();
+
+    const bool bPrevScan = GC.GetConservativeStackScan();
+    GC.SetConservativeStackScan(false);
+
+    // Root -> Child -> GrandChild, all in the normal heap; then Root moves to the permanent region.
+    QTestObject* Root = NewObject<QTestObject>();
+    QTestObject* Child = NewObject<QTestObject>();
+    QTestObject* GrandChild = NewObject<QTestObject>();
+    GC.AddRoot(Root);
+    GC.Link(Root, "Friend1", Child);
+    GC.Link(Child, "Children", GrandChild);
+    const uint64_t ChildId = Child->GetObjectId();
+    const uint64_t GrandChildId = GrandChild->GetObjectId();
+
+    const bool bMoved = GC.MakePermanent(Root, true);
+    GC.Collect(true);
+
+    const bool bChild = GC.FindById(ChildId) == Child && Root->Friend1 == Child;
+    const bool bGrandChild = GC.FindById(GrandChildId) == GrandChild;
+
+    // Permanent objects are never freed; drop Root's edge so only the empty Root stays behind.
+    Root->Friend1 = nullptr;
+    GC.RemoveRoot(Root);
+    GC.SetConservativeStackScan(bPrevScan);
+    GC.Collect(true);
+
+    std::cout << "[GcTestManager] CheckMakePermanent moved=" << (bMoved ? "yes" : "no") << ", child=" << (bChild ? "kept" : "lost")
+              << ", grandchild=" << (bGrandChild ? "kept" : "lost") << "\n";
+    if (!bMoved || !bChild || !bGrandChild)
+    {
+        std::cout << "[GcTestManager] FAILED: references of an object made permanent were not scanned\n";
+    }
+}
+
+void QGcTestManager::CheckNameTable()
+{
+    constexpr int NumThreads = 8;
+    constexpr int NamesPerThread = 40000;  // 320k distinct names in total
+    constexpr int NumShared = 4000;
+
+    // No "_<digits>" tail, so every string is its own table entry rather than a number suffix.
+    auto OwnName = [](int Thread, int i) { return "NameCheckT" + std::to_string(Thread) + "x" + std::to_string(i); };
+    auto SharedName = [](int i) { return "NameCheckShared" + std::to_string(i); };
+
+    std::vector<std::vector<uint32_t>> Own(NumThreads), Shared(NumThreads);
+    std::vector<std::thread> Threads;
+    for (int t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&, t]
+        {
+            for (int i = 0; i < NamesPerThread; ++i)
+            {
+                Own[t].push_back(FName(OwnName(t, i)).GetIndex());
+                if (i < NumShared)
+                {
+                    Shared[t].push_back(FName(SharedName(i)).GetIndex());
+                }
+            }
+        });
+    }
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    size_t NumSharedMismatch = 0;
+    for (int t = 1; t < NumThreads; ++t)
+    {
+        NumSharedMismatch += Shared[t] != Shared[0] ? 1 : 0;
+    }
+
+    size_t NumCollisions = 0, NumLookupMisses = 0;
+    std::vector<bool> Seen(FName::GetNumEntries(), false);
+    for (int t = 0; t < NumThreads; ++t)
+    {
+        for (int i = 0; i < NamesPerThread; ++i)
+        {
+            const uint32_t Index = Own[t][i];
+            NumCollisions += Seen[Index] ? 1 : 0;
+            Seen[Index] = true;
+            NumLookupMisses += FName::Find(OwnName(t, i)).GetIndex() != Index ? 1 : 0;
+        }
+    }
+
+    std::cout << "[GcTestManager] CheckNameTable threads=" << NumThreads << " names=" << NumThreads * NamesPerThread
+              << " entries=" << FName::GetNumEntries() << " sharedMismatch=" << NumSharedMismatch
+              << " collisions=" << NumCollisions << " lookupMisses=" << NumLookupMisses << "\n";
+    if (NumSharedMismatch || NumCollisions || NumLookupMisses)
+    {
+        std::cout << "[GcTestManager] FAILED: concurrent FName inserts disagree\n";
+    }
+}
+
+void QGcTestManager::BenchmarkTeardown(int Count, int Megabytes)
+{
+    if (Count <= 0 || Megabytes <= 0)
+    {
+        std::cout << "[GcTestManager] BenchmarkTeardown: count>0, megabytes>0\n";
+        return;
+    }
+
+    auto& GC = GarbageCollector::Get();
+    GC.ProcessPendingKill(true);
+    GC.Collect(true);
+
+    auto Measure = [&](bool bAsync, double& OutSweepMs, size_t& OutPending)
+    {
+        for (int i = 0; i < Count; ++i)
+        {
+            QTestResourceObject* Obj = NewObject<QTestResourceObject>();
+            Obj->bAsyncTeardown = bAsync;
+            Obj->Acquire(Megabytes);
+        }
+
+        GC.Collect(true);
+        OutSweepMs = GC.GetLastStats().SweepMs;
+        OutPending = GC.GetLastStats().NumPendingKill;
+        GC.ProcessPendingKill(true);
+    };
+
+    double SyncSweep = 0.0, AsyncSweep = 0.0;
+    size_t SyncPending = 0, AsyncPending = 0;
+    Measure(false, SyncSweep, SyncPending);
+    Measure(true, AsyncSweep, AsyncPending);
+
+    std::cout << "[GcTestManager] BenchmarkTeardown count=" << Count << " MB/object=" << Megabytes << "\n";
+    std::cout << " - in-pause teardown: sweep=" << SyncSweep << " ms, pendingKill=" << SyncPending << "\n";
+    std::cout << " - BeginDestroy async: sweep=" << AsyncSweep << " ms, pendingKill=" << AsyncPending << "\n";
+}
+
+void QGcTestManager::BenchmarkCalls(int Count)
+{
+    if (Count <= 0)
+    {
+        std::cout << "[GcTestManager] BenchmarkCalls: count>0\n";
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto NsPerCall = [Count](Clock::time_point A, Clock::time_point B)
+    {
+        return std::chrono::duration<double, std::nano>(B - A).count() / Count;
+    };
+
+    auto& GC = GarbageCollector::Get();
+    QTestObject* Obj = NewObject<QTestObject>();
+    FGCScopedRoot Root(Obj);
+
+    const auto TName0 = Clock::now();
+    for (int i = 0; i < Count; ++i)
+    {
+        GC.Call(Obj, "SetInteger", { qmeta::Variant(i) });
+    }
+    const auto TName1 = Clock::now();
+
+    const qmeta::FunctionHandle SetInteger = GC.FindFunction(Obj, "SetInteger");
+    const auto THandle0 = Clock::now();
+    for (int i = 0; i < Count; ++i)
+    {
+        const qmeta::Variant Args[] = { qmeta::Variant(i) };
+        GC.Call(Obj, SetInteger, Args);
+    }
+    const auto THandle1 = Clock::now();
+
+    const auto TypedSetInteger = qmeta::TypedFunctionHandle<void(int)>::Resolve(*GC.GetTypeInfo(Obj), "SetInteger");
+    size_t NumFailed = 0;
+    const auto TTyped0 = Clock::now();
+    for (int i = 0; i < Count; ++i)
+    {
+        NumFailed += !qmeta::Invoke(Obj, TypedSetInteger, i).Ok();
+    }
+    const auto TTyped1 = Clock::now();
+
+    const auto TDirect0 = Clock::now();
+    for (int i = 0; i < Count; ++i)
+    {
+        Obj->SetInteger(i);
+    }
+    const auto TDirect1 = Clock::now();
+
+    std::cout << "[GcTestManager] BenchmarkCalls count=" << Count << " (Integer=" << Obj->Integer << ")\n";
+    std::cout << " - by name: " << NsPerCall(TName0, TName1) << " ns/call\n";
+    std::cout << " - handle:  " << NsPerCall(THandle0, THandle1) << " ns/call\n";
+    std::cout << " - typed:   " << NsPerCall(TTyped0, TTyped1) << " ns/call" << (NumFailed ? " (FAILED)" : "") << "\n";
+    std::cout << " - direct:  " << NsPerCall(TDirect0, TDirect1) << " ns/call\n";
+}
+
+void QGcTestManager::BenchmarkTransient(int Count)
+{
+    if (Count <= 0)
+    {
+        std::cout << "[GcTestManager] BenchmarkTransient: count>0\n";
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto Ms = [](Clock::time_point A, Clock::time_point B) { return std::chrono::duration<double, std::milli>(B - A).count(); };
+
+    auto& GC = GarbageCollector::Get();
+    GC.Collect(true);
+    const double BaseCollectMs = GC.GetLastStats().TotalMs;
+
+    // Managed: created, then swept by the next collection.
+    const auto TManaged0 = Clock::now();
+    QTestObject* Prev = nullptr;
+    for (int i = 0; i < Count; ++i)
+    {
+        QTestObject* Obj = NewObject<QTestObject>();
+        Obj->Friend1 = Prev;
+        Prev = Obj;
+    }
+    const auto TManaged1 = Clock::now();
+    GC.Collect(true);
+    const double ManagedCollectMs = GC.GetLastStats().TotalMs;
+
+    // Transient: the collection in between does not see them, the scope releases them.
+    double TransientCreateMs = 0.0, TransientCollectMs = 0.0, ReleaseMs = 0.0;
+    {
+        const auto TCreate0 = Clock::now();
+        auto TRelease0 = TCreate0;
+        {
+            FFrameArenaScope Scope;
+            Prev = nullptr;
+            for (int i = 0; i < Count; ++i)
+            {
+                QTestObject* Obj = NewTransientObject<QTestObject>();
+                Obj->Friend1 = Prev;
+                Prev = Obj;
+            }
+            TransientCreateMs = Ms(TCreate0, Clock::now());
+            
+            GC.Collect(true);
+            TransientCollectMs = GC.GetLastStats().TotalMs;
+            TRelease0 = Clock::now();
+        }
+        ReleaseMs = Ms(TRelease0, Clock::now());
+    }
+
+    std::cout << "[GcTestManager] BenchmarkTransient count=" << Count << " (empty collect=" << BaseCollectMs << " ms)\n";
+    std::cout << " - NewObject:          create=" << Ms(TManaged0, TManaged1) << " ms, collect=" << ManagedCollectMs << " ms\n";
+    std::cout << " - NewTransientObject: create=" << TransientCreateMs << " ms, collect=" << TransientCollectMs
+              << " ms, release=" << ReleaseMs << " ms\n";
+}
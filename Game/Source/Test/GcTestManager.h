@@ -10,6 +10,8 @@
 class QGcTestManager : public QObject
 {
 public:
+    // Its reflected tests run collections while they execute, so it must never be moved under itself.
+    static constexpr bool bGcPinned = true;
 
     QGcTestManager();
 
@@ -124,6 +126,10 @@ public:
     QFUNCTION()
     void PatternRings(int Rings, int RingSize, int Seed);
 
+    // Same as PatternRandom, but every tester builds its graph on its own thread.
+    QFUNCTION()
+    void PatternRandomParallel(int Nodes, int AvgOut, int Seed);
+
     QFUNCTION()
     void BreakRandomEdges(int Count, int Seed);
 
@@ -137,6 +143,59 @@ public:
 
     QFUNCTION()
     void ClearAll(bool bSilent);
+
+    // Builds one random graph per tester, then compares mark time with and without one cluster per tester.
+    QFUNCTION()
+    void BenchmarkClusters(int NodesPerTester, int AvgOut, int Repeats);
+
+    // Creates Count unreferenced QTestResourceObjects holding Megabytes each and compares the sweep time when their
+    // buffers are released inside the pause versus from BeginDestroy() on a worker thread.
+    QFUNCTION()
+    void BenchmarkTeardown(int Count, int Megabytes);
+
+    // Builds the same chain of Count QTestObjects as managed objects and as frame-arena transients, and compares
+    // creation, collection and release time.
+    QFUNCTION()
+    void BenchmarkTransient(int Count);
+
+    // Builds one random graph per tester inside the tester's root region, then cuts BreakCount edges in the first
+    // tester and compares a full collection with a collection of that tester's region only.
+    QFUNCTION()
+    void BenchmarkRegion(int NodesPerTester, int AvgOut, int BreakCount);
+
+    // Builds one random graph per tester, cuts BreakCount edges in each, and compares the pauses of a stop-the-world
+    // collection with a fork-mode one (fork, then fixup and sweep). Linux only.
+    QFUNCTION()
+    void BenchmarkForkMark(int NodesPerTester, int AvgOut, int BreakCount);
+
+    // Keeps Count (up to 16) unrooted QTestObjects in a local array across a collection with the conservative stack
+    // scan on and off, and reports how many survived each.
+    QFUNCTION()
+    void CheckStackScan(int Count);
+
+    // Calls QTestObject::SetInteger Count times by name, through a resolved FunctionHandle, through a typed handle
+    // (qmeta::Invoke), and directly, and reports the cost per call of each.
+    QFUNCTION()
+    void BenchmarkCalls(int Count);
+
+    // Links a new object into a member of an existing cluster, collects, and checks the object and the edge survive.
+    QFUNCTION()
+    void CheckClusterLink();
+
+    // Moves a rooted object with children to the permanent region (bReferencesAsRoots), collects, and checks the
+    // children survive.
+    QFUNCTION()
+    void CheckMakePermanent();
+
+    // Threads intern the same names and their own distinct names at once, enough to grow the name table several
+    // times, and checks that every thread got one index per shared name and that distinct names never collide.
+    QFUNCTION()
+    void CheckNameTable();
+
+    // Worker threads (registered mutators) rebuild their tester's roots in a loop, taking a safepoint after each
+    // rebuild, while this thread collects continuously. Reports time-to-safepoint and checks the final heap.
+    QFUNCTION()
+    void StressMutators(int NumThreads, int Iterations, int Nodes);
     
 private:
     ERootAttachMode RootMode { ERootAttachMode::GarbageCollectorRoots };
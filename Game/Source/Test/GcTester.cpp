@@ -15,45 +15,10 @@
 // ---------------- local helpers ----------------
 namespace
 {
-    inline std::string TrimSpaces(std::string s)
+    // Whether a QObject reference property may point at an object of ChildTi (its declared pointee is ChildTi or a base)
+    inline bool IsAssignableTo(const qmeta::MetaProperty& Prop, const qmeta::TypeInfo& ChildTi)
     {
-        s.erase(std::remove_if(s.begin(), s.end(), ::isspace), s.end());
-        return s;
-    }
-
-    // Extract inner from "std::vector<T*>" -> "T*"; returns empty if not vector
-    inline std::string VectorElem(const std::string& Type)
-    {
-        if (Type.find("std::vector") == std::string::npos) return {};
-        auto lt = Type.find('<');
-        auto gt = Type.rfind('>');
-        if (lt == std::string::npos || gt == std::string::npos || lt >= gt) return {};
-        auto inner = TrimSpaces(Type.substr(lt + 1, gt - lt - 1));
-        return inner;
-    }
-
-    // From "T*" -> "T"
-    inline std::string PointeeName(const std::string& PtrType)
-    {
-        std::string s = TrimSpaces(PtrType);
-        if (!s.empty() && s.back() == '*') s.pop_back();
-        return s;
-    }
-
-    // Whether DeclTypeName is base-of-or-equal to ChildTi
-    inline bool IsAssignableTo(const std::string& DeclTypeName, const qmeta::TypeInfo& ChildTi)
-    {
-        if (DeclTypeName.empty()) return false;
-        // Fast path exact match
-        if (DeclTypeName == ChildTi.name) return true;
-
-        const qmeta::TypeInfo* B = ChildTi.base;
-        while (B)
-        {
-            if (B->name == DeclTypeName) return true;
-            B = B->base;
-        }
-        return false;
+        return Prop.ref_type && ChildTi.IsA(*Prop.ref_type);
     }
 
     // Enumerate properties with control over local/parents
@@ -78,8 +43,30 @@ namespace
 
 // ---------------- QGcTester core ----------------
 
+void QGcTester::PostGcCompact(const std::unordered_map<QObject*, QObject*>& Relocated)
+{
+    auto Remap = [&](std::vector<QObject*>& Nodes)
+    {
+        for (QObject*& Node : Nodes)
+        {
+            if (auto It = Relocated.find(Node); It != Relocated.end())
+            {
+                Node = It->second;
+            }
+        }
+    };
+
+    Remap(AllNodes);
+    for (std::vector<QObject*>& Layer : DepthLayers)
+    {
+        Remap(Layer);
+    }
+}
+
 void QGcTester::ClearGraph()
 {
+    // A clustered graph would stay alive as a unit, so drop the cluster along with the references.
+    GarbageCollector::Get().DissolveCluster(this);
     Roots.clear();
     AllNodes.clear();
     DepthLayers.clear();
@@ -138,9 +125,7 @@ void QGcTester::LinkChild(QObject* Parent, QObject* Child, std::mt19937* RngOpt)
             if (bUseVector && bVec)
             {
                 // vector<T*>
-                const std::string ElemPtr = VectorElem(T); // "T*"
-                const std::string ElemName = PointeeName(ElemPtr); // "T"
-                if (!IsAssignableTo(ElemName, *ChildTi)) continue;
+                if (!IsAssignableTo(*P, *ChildTi)) continue;
 
                 // Reinterpret as vector<QObject*>; we'll store QObject* uniformly.
                 auto* Vec = reinterpret_cast<std::vector<QObject*>*>(Base + P->offset);
@@ -152,8 +137,7 @@ void QGcTester::LinkChild(QObject* Parent, QObject* Child, std::mt19937* RngOpt)
             }
             else if (!bUseVector && bRaw && !bVec) // ensure not vector
             {
-                const std::string DeclName = PointeeName(T);
-                if (!IsAssignableTo(DeclName, *ChildTi)) continue;
+                if (!IsAssignableTo(*P, *ChildTi)) continue;
 
                 auto** Slot = reinterpret_cast<QObject**>(Base + P->offset);
                 if (*Slot == nullptr)
@@ -571,6 +555,9 @@ void QGcTester::PatternRings(int Rings, int RingSize, int Seed)
 
 int QGcTester::BreakAtDepth(int TargetDepth, int Count, int Seed)
 {
+    // Cluster members are treated as frozen; unfreeze before editing edges.
+    GarbageCollector::Get().DissolveCluster(this);
+
     if (TargetDepth <= 0) { std::cout << "[GcTester] TargetDepth must be > 0\n"; return 0; }
     if (DepthLayers.empty()) { std::cout << "[GcTester] Depth layer is empty.\n"; return 0; }
     if (TargetDepth >= (int)DepthLayers.size()) { std::cout << "[GcTester] Invalid depth\n"; return 0; }
@@ -633,6 +620,8 @@ int QGcTester::BreakAtDepth(int TargetDepth, int Count, int Seed)
 
 int QGcTester::BreakPercent(double Percent, int Depth, int Seed, bool /*bOnlyRoots*/)
 {
+    GarbageCollector::Get().DissolveCluster(this);
+
     Percent = std::clamp(Percent, 0.0, 100.0);
     std::mt19937 Rng(static_cast<uint32_t>(Seed));
     auto Roll = [&](std::mt19937& G) -> bool
@@ -711,6 +700,8 @@ int QGcTester::BreakPercent(double Percent, int Depth, int Seed, bool /*bOnlyRoo
 
 void QGcTester::BreakRandomEdges(int Count, int Seed)
 {
+    GarbageCollector::Get().DissolveCluster(this);
+
     if (Count <= 0) return;
 
     std::mt19937 Rng(static_cast<uint32_t>(Seed));
@@ -733,6 +724,8 @@ void QGcTester::BreakRandomEdges(int Count, int Seed)
 
 void QGcTester::DetachRoots(int Count, double Percent)
 {
+    GarbageCollector::Get().DissolveCluster(this);
+
     int Removed = 0;
 
     if (Count > 0)
@@ -763,6 +756,7 @@ void QGcTester::ClearAll(bool bSilent)
 void QGcTester::ClearGenerated()
 {
     // Only drop references here. The GC will reclaim unreachable objects.
+    GarbageCollector::Get().DissolveCluster(this);
     AllNodes.clear();
     Roots.clear();
 }
@@ -72,6 +72,9 @@ public:
     QFUNCTION() void FactoryAddType(const std::string& TypeName);   // requires the type was registered
     QFUNCTION() void FactoryUseTypes(const std::vector<std::string>& TypeNames);
 
+    // AllNodes/DepthLayers are not reflected, so the GC cannot rewrite them itself.
+    void PostGcCompact(const std::unordered_map<QObject*, QObject*>& Relocated) override;
+
 private:
     // ---------- Generic internals (QObject-based) ----------
     struct EdgeRef
@@ -0,0 +1,41 @@
+﻿#include "TestResourceObject.h"
+
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+    constexpr size_t ChunkSize = 64 * 1024;
+}
+
+void QTestResourceObject::Acquire(int Megabytes)
+{
+    const size_t Count = Megabytes > 0 ? size_t(Megabytes) * 1024 * 1024 / ChunkSize : 0;
+    Chunks.reserve(Chunks.size() + Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        auto Chunk = std::make_unique<char[]>(ChunkSize);
+        std::memset(Chunk.get(), 0xCD, ChunkSize);
+        Chunks.push_back(std::move(Chunk));
+    }
+    NumChunks = static_cast<int>(Chunks.size());
+}
+
+void QTestResourceObject::BeginDestroy()
+{
+    if (!bAsyncTeardown)
+    {
+        Chunks.clear();
+        return;
+    }
+    
+    Teardown = std::async(std::launch::async, [Owned = std::move(Chunks)]() mutable
+    {
+        Owned.clear();
+    });
+}
+
+bool QTestResourceObject::IsReadyForFinishDestroy()
+{
+    return !Teardown.valid() || Teardown.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
@@ -0,0 +1,31 @@
+﻿#pragma once
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "Object.h"
+#include "qmeta_macros.h"
+
+// Test object owning a large buffer whose release is expensive, used to exercise two-phase destruction.
+// With bAsyncTeardown the buffer is released on a worker thread started from BeginDestroy(); otherwise it is
+// released inside BeginDestroy(), i.e. inside the GC pause.
+class QTestResourceObject : public QObject
+{
+public:
+    QPROPERTY()
+    bool bAsyncTeardown = true;
+
+    QPROPERTY()
+    int NumChunks = 0;
+
+    // Allocates and touches Megabytes of memory in 64KB chunks.
+    QFUNCTION()
+    void Acquire(int Megabytes);
+
+    void BeginDestroy() override;
+    bool IsReadyForFinishDestroy() override;
+
+private:
+    std::vector<std::unique_ptr<char[]>> Chunks;
+    std::future<void> Teardown;
+};
@@ -261,6 +261,7 @@ HEADER_H = r"""// Auto-generated by QHT. Do not edit.
 #include <string>
 #include <unordered_map>
 #include <stdexcept>
+#include <utility>
 #include "qmeta_runtime.h"
 using namespace qmeta;
 """
@@ -324,12 +325,21 @@ def emit_header(classes, out_path: Path, unit: str, bases, qobject_names: set[st
                 )
             lines.append(body)
 
+            # Typed thunk: same call with the declared signature, no Variant boxing (see qmeta::Invoke)
+            typed_params = "".join([f", {pt} _p{idx}" for idx, (pt, pn) in enumerate(fn.params)])
+            typed_args = ", ".join([f"std::forward<{pt}>(_p{idx})" for idx, (pt, pn) in enumerate(fn.params)])
+            lines.append(
+                f"static {fn.ret} _qmeta_typed_{cname}_{fn.name}(void* Self{typed_params}) {{\n"
+                f"    return static_cast<{cname}*>(Self)->{fn.name}({typed_args});\n}}\n\n"
+            )
+
     # Emit registry adder
     lines.append(f"inline void QHT_Register_{unit}(Registry& R) {{\n")
     for ci in classes:
         cname = ci.name
         lines.append(f"    TypeInfo& T_{cname} = R.add_type(\"{cname}\", sizeof({cname}));\n")
         lines.append(f'    T_{cname}.meta = MetaMap{{ std::make_pair(std::string("Module"), std::string("{unit}")) }};\n')
+        lines.append(f"    T_{cname}.relocate = qmeta::GetRelocateFn<{cname}>();\n")
 
         bases = _extract_base_names(ci.bases)
         if bases:
@@ -341,9 +351,10 @@ def emit_header(classes, out_path: Path, unit: str, bases, qobject_names: set[st
             meta_code = f"MetaMap{{ {meta_items} }}" if meta_items else "MetaMap{}"
             mask = classify_gc_flags(p.type, qobject_names)
             flags_code = gcflags_expr(mask)
+            type_code = property_type_expr(p.type, qobject_names)
             lines.append(
                 f"    T_{cname}.properties.push_back(MetaProperty{{\"{p.name}\", \"{p.type}\", "
-                f"offsetof({cname}, {p.name}), {meta_code}, {flags_code} }});\n"
+                f"offsetof({cname}, {p.name}), {meta_code}, {flags_code}, {type_code} }});\n"
             )
         for f in ci.functions:
             params_vec = ", ".join([f"MetaParam{{\"{pn}\", \"{pt}\"}}" for (pt,pn) in f.params])
@@ -355,6 +366,7 @@ def emit_header(classes, out_path: Path, unit: str, bases, qobject_names: set[st
             lines.append(f"        F.name = \"{f.name}\";\n")
             lines.append(f"        F.return_type = \"{f.ret}\";\n")
             lines.append(f"        F.invoker = &{inv_name};\n")
+            lines.append(f"        F.SetTypedInvoker(&_qmeta_typed_{cname}_{f.name});\n")
             lines.append(f"        F.params = std::vector<MetaParam>{{ {params_vec} }};\n")
             lines.append(f"        F.meta = {meta_code};\n")
             lines.append( "        T_{cname}.functions.push_back(std::move(F));\n".replace("{cname}", cname))
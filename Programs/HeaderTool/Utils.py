@@ -68,3 +68,37 @@ def gcflags_expr(mask: int) -> str:
     if mask & (1 << 0): parts.append("PF_RawQObjectPtr")
     if mask & (1 << 1): parts.append("PF_VectorOfQObjectPtr")
     return " | ".join(parts)
+
+# Mirrors qmeta::EPropertyType (qmeta_runtime.h); values are emitted by name.
+_SCALAR_TYPE_CODES = {
+    "int": "Int32", "int32_t": "Int32", "int32": "Int32",
+    "unsigned int": "UInt32", "unsigned": "UInt32", "uint32_t": "UInt32", "uint32": "UInt32",
+    "int64_t": "Int64", "long long": "Int64", "int64": "Int64",
+    "uint64_t": "UInt64", "unsigned long long": "UInt64", "uint64": "UInt64",
+    "float": "Float", "double": "Double", "bool": "Bool",
+    "std::string": "String", "string": "String",
+    "FVector": "FVector",
+}
+
+def classify_property_type(type_str: str, qset: set[str]):
+    """Returns (EPropertyType enumerator name, element type spelling) for a reflected property type."""
+    s = _strip_cvref(type_str)
+    mask = classify_gc_flags(s, qset)
+    if mask & (1 << 0):
+        return "ObjectRef", s
+    if s.startswith('std::vector'):
+        elem = _first_template_arg(s)
+        if elem is None:
+            return "Unknown", s
+        elem = _strip_cvref(elem)
+        if mask & (1 << 1):
+            return "ObjectRefArray", elem
+        code = _SCALAR_TYPE_CODES.get(elem)
+        if code is None or code == "FVector":
+            return "Unknown", s
+        return code + "Array", elem
+    return _SCALAR_TYPE_CODES.get(s, "Unknown"), s
+
+def property_type_expr(type_str: str, qset: set[str]) -> str:
+    code, elem = classify_property_type(type_str, qset)
+    return f"EPropertyType::{code}, sizeof({elem}), alignof({elem})"